@@ -6,24 +6,70 @@
 #include <math.h>
 #include <stdlib.h>
 
+#include "pixels.h"
 #include "utils.h"
 
+#define EASE_LUT_BITS 6
+#define EASE_LUT_SIZE ((1 << EASE_LUT_BITS) + 1)
+
+// ANIM_EASE_IN .. ANIM_EASE_PULSE, 0..65535 sampled at 64 points (cubic in/out/in-out, half cosine, sin^2)
+static const u16 EASE_LUT[5][EASE_LUT_SIZE] = {
+	// in
+	{
+		0, 0, 2, 7, 16, 31, 54, 86, 128, 182, 250, 333, 432,
+		549, 686, 844, 1024, 1228, 1458, 1715, 2000, 2315, 2662, 3042, 3456, 3906,
+		4394, 4921, 5488, 6097, 6750, 7448, 8192, 8984, 9826, 10719, 11664, 12663, 13718,
+		14830, 16000, 17230, 18522, 19876, 21296, 22781, 24334, 25955, 27648, 29412, 31250, 33162,
+		35151, 37219, 39365, 41593, 43903, 46298, 48777, 51344, 53999, 56744, 59581, 62511, 65535
+	},
+	// out
+	{
+		0, 3024, 5954, 8791, 11536, 14191, 16758, 19237, 21632, 23942, 26170, 28316, 30384,
+		32373, 34285, 36123, 37887, 39580, 41201, 42754, 44239, 45659, 47013, 48305, 49535, 50705,
+		51817, 52872, 53871, 54816, 55709, 56551, 57343, 58087, 58785, 59438, 60047, 60614, 61141,
+		61629, 62079, 62493, 62873, 63220, 63535, 63820, 64077, 64307, 64511, 64691, 64849, 64986,
+		65103, 65202, 65285, 65353, 65407, 65449, 65481, 65504, 65519, 65528, 65533, 65535, 65535
+	},
+	// in_out
+	{
+		0, 1, 8, 27, 64, 125, 216, 343, 512, 729, 1000, 1331, 1728,
+		2197, 2744, 3375, 4096, 4913, 5832, 6859, 8000, 9261, 10648, 12167, 13824, 15625,
+		17576, 19683, 21952, 24389, 27000, 29791, 32768, 35744, 38535, 41146, 43583, 45852, 47959,
+		49910, 51711, 53368, 54887, 56274, 57535, 58676, 59703, 60622, 61439, 62160, 62791, 63338,
+		63807, 64204, 64535, 64806, 65023, 65192, 65319, 65410, 65471, 65508, 65527, 65534, 65535
+	},
+	// sine
+	{
+		0, 39, 158, 355, 630, 982, 1411, 1915, 2494, 3146, 3869, 4662, 5522,
+		6448, 7438, 8488, 9597, 10762, 11980, 13248, 14563, 15922, 17321, 18758, 20228, 21728,
+		23256, 24806, 26375, 27960, 29556, 31160, 32767, 34375, 35979, 37575, 39160, 40729, 42279,
+		43807, 45307, 46777, 48214, 49613, 50972, 52287, 53555, 54773, 55938, 57047, 58097, 59087,
+		60013, 60873, 61666, 62389, 63041, 63620, 64124, 64553, 64905, 65180, 65377, 65496, 65535
+	},
+	// pulse
+	{
+		0, 158, 630, 1411, 2494, 3869, 5522, 7438, 9597, 11980, 14563, 17321, 20228,
+		23256, 26375, 29556, 32767, 35979, 39160, 42279, 45307, 48214, 50972, 53555, 55938, 58097,
+		60013, 61666, 63041, 64124, 64905, 65377, 65535, 65377, 64905, 64124, 63041, 61666, 60013,
+		58097, 55938, 53555, 50972, 48214, 45307, 42279, 39160, 35979, 32768, 29556, 26375, 23256,
+		20228, 17321, 14563, 11980, 9597, 7438, 5522, 3869, 2494, 1411, 630, 158, 0
+	}
+};
+
 static void adjust_frame_by_speed_freq(const u16 frame, const u16 frame_count, const float speed,
 								const float freq, u16 *divisor, float *adjusted_frame) {
 	*divisor = frame_count / freq;
 	*adjusted_frame = fmod(frame, *divisor) * speed;
 }
 
-u32 anim_reduce_brightness(const u32 reduction, const u32 color) {
-	u16 r = (color >> 16) & 0b11111111;
-	u16 g = (color >> 8) & 0b11111111;
-	u16 b = color & 0b11111111;
-
-	r = (r > reduction) ? (r - reduction) : 0;
-	g = (g > reduction) ? (g - reduction) : 0;
-	b = (b > reduction) ? (b - reduction) : 0;
+// dims to black in the middle of the cycle and comes back
+static inline u8 pulse_reduction(const u8 reduction) {
+	return reduction < 128 ? reduction * 2 : (255 - reduction) * 2 + 1;
+}
 
-	return (utils_min(r, 255) << 16) | (utils_min(g, 255) << 8) | utils_min(b, 255);
+u32 anim_reduce_brightness(const u32 reduction, const u32 color) {
+	const u32 packed = utils_min(reduction, 255u) * 0x00'01'01'01u; // R, G, B - top byte gets dropped anyway
+	return pixels_sub_color(color & 0x00'FF'FF'FFu, packed);
 }
 
 u8 anim_color_reduction(const anim_direction_t direction, const u16 frame, const u16 frame_count, const float speed,
@@ -36,7 +82,7 @@ u8 anim_color_reduction(const anim_direction_t direction, const u16 frame, const
 	u8 reduction = utils_proportional_reduce(255, adjusted_frame, divisor, false);
 
 	if (direction == TO_BRIGHT) reduction = 255 - reduction;
-	// TODO: PULSE
+	if (direction == PULSE) reduction = pulse_reduction(reduction);
 
 	return reduction;
 }
@@ -66,3 +112,165 @@ u32 anim_color_blend(const u32 color_from, const u32 color_to, const u16 frame,
 		(g1 > g2 ? g1 - g_diff : g1 + g_diff) << 8 |
 		(b1 > b2 ? b1 - b_diff : b1 + b_diff);
 }
+
+q16_t anim_phase_q16(const u16 frame, const u16 frame_count, const q16_t speed, const q16_t freq) {
+	if (unlikely(freq <= 0)) return Q16_ONE;
+
+	// same truncation as adjust_frame_by_speed_freq: divisor = frame_count / freq
+	const u32 divisor = ((u32)frame_count << 16) / (u32)freq;
+	if (unlikely(divisor == 0)) return Q16_ONE;
+
+	const u64 adjusted = (u64)(frame % divisor) * (u32)utils_max(speed, 0); // Q16
+	const u64 limit = (u64)divisor << 16;
+	const u64 clamped = adjusted >= limit ? limit : adjusted;
+	if (likely(clamped <= UINT32_MAX)) return (q16_t)((u32)clamped / divisor); // keep it a single UDIV
+	return (q16_t)(clamped / divisor);
+}
+
+u8 anim_color_reduction_q16(const anim_direction_t direction, const q16_t phase) {
+	u8 reduction = (u8)utils_proportional_reduce_q16(255, phase, false);
+
+	if (direction == TO_BRIGHT) reduction = 255 - reduction;
+	if (direction == PULSE) reduction = pulse_reduction(reduction);
+
+	return reduction;
+}
+
+static inline u32 blend_channel_q16(const u32 from, const u32 to, const q16_t phase) {
+	if (from > to) return from - (u32)utils_proportional_reduce_q16((i32)(from - to), phase, false);
+	return from + (u32)utils_proportional_reduce_q16((i32)(to - from), phase, false);
+}
+
+u32 anim_color_blend_q16(const u32 color_from, const u32 color_to, const q16_t phase) {
+	const auto r = blend_channel_q16((color_from >> 16) & 0b11111111, (color_to >> 16) & 0b11111111, phase);
+	const auto g = blend_channel_q16((color_from >> 8) & 0b11111111, (color_to >> 8) & 0b11111111, phase);
+	const auto b = blend_channel_q16(color_from & 0b11111111, color_to & 0b11111111, phase);
+
+	return r << 16 | g << 8 | b;
+}
+
+u16 anim_ease(const anim_ease_t ease, const u16 t) {
+	switch (ease) {
+		case ANIM_EASE_LINEAR: return t;
+		case ANIM_EASE_STEP: return t == UINT16_MAX ? UINT16_MAX : 0;
+		case ANIM_EASE_IN:
+		case ANIM_EASE_OUT:
+		case ANIM_EASE_IN_OUT:
+		case ANIM_EASE_SINE:
+		case ANIM_EASE_PULSE: {
+			const u16 *lut = EASE_LUT[ease - ANIM_EASE_IN];
+			const u32 idx = t >> (16 - EASE_LUT_BITS);
+			const i32 frac = t & ((1 << (16 - EASE_LUT_BITS)) - 1);
+			const i32 a = lut[idx];
+			const i32 b = lut[idx + 1];
+			return (u16)(a + (((b - a) * frac) >> (16 - EASE_LUT_BITS)));
+		}
+	}
+	return t;
+}
+
+static void track_set_segment(anim_track_t *track, const u16 segment) {
+	track->segment = segment;
+	track->segment_start_ms = track->keys[segment].time_ms;
+	track->segment_end_ms = track->keys[segment + 1].time_ms;
+	const u32 len = track->segment_end_ms - track->segment_start_ms;
+	track->segment_recip = len == 0 ? 0 : UINT32_MAX / len; // only on segment change
+}
+
+void anim_track_init(anim_track_t *track, const anim_keyframe_t *keys, const u16 key_count, const anim_loop_t loop) {
+	*track = (anim_track_t) { 0 };
+	track->keys = keys;
+	track->key_count = key_count;
+	track->loop = loop;
+	if (key_count == 0) return;
+
+	track->duration_ms = keys[key_count - 1].time_ms;
+	if (key_count >= 2) track_set_segment(track, 0);
+}
+
+void anim_track_start(anim_track_t *track, const u32 now_us) {
+	track->start_us = now_us;
+	if (track->key_count >= 2) track_set_segment(track, 0);
+}
+
+static u32 track_local_time(const anim_track_t *track, const u32 t_ms) {
+	if (track->duration_ms == 0) return 0;
+
+	switch (track->loop) {
+		case ANIM_LOOP_ONCE:
+			return utils_min(t_ms, track->duration_ms);
+		case ANIM_LOOP_REPEAT:
+			return t_ms < track->duration_ms ? t_ms : t_ms % track->duration_ms;
+		case ANIM_LOOP_PING_PONG: {
+			const u32 period = track->duration_ms * 2;
+			const u32 local = t_ms < period ? t_ms : t_ms % period;
+			return local <= track->duration_ms ? local : period - local;
+		}
+	}
+	return 0;
+}
+
+static void track_seek(anim_track_t *track, const u32 local_ms) {
+	if (local_ms >= track->segment_start_ms && local_ms < track->segment_end_ms) return;
+
+	const u16 last_segment = track->key_count - 2;
+	// sequential playback usually only steps to the next segment
+	if (track->segment < last_segment && local_ms >= track->segment_end_ms &&
+		local_ms < track->keys[track->segment + 2].time_ms) {
+		track_set_segment(track, track->segment + 1);
+		return;
+	}
+
+	u16 lo = 0, hi = last_segment;
+	while (lo < hi) {
+		const u16 mid = (lo + hi + 1) / 2;
+		if (track->keys[mid].time_ms <= local_ms) lo = mid;
+		else hi = mid - 1;
+	}
+	track_set_segment(track, lo);
+}
+
+// returns eased progress inside current segment, 0..65535
+static u16 track_progress(anim_track_t *track, const u32 t_ms) {
+	const u32 local = track_local_time(track, t_ms);
+	track_seek(track, local);
+
+	if (local < track->segment_start_ms) return 0; // before first key, hold its value
+	if (local >= track->segment_end_ms || track->segment_recip == 0) return UINT16_MAX;
+	const u32 offset = local - track->segment_start_ms;
+	const u32 progress = (u32)(((u64)offset * track->segment_recip + 0x8000u) >> 16);
+	return anim_ease(track->keys[track->segment].ease, (u16)utils_min(progress, (u32)UINT16_MAX));
+}
+
+i32 anim_track_eval(anim_track_t *track, const u32 t_ms) {
+	if (unlikely(track->key_count == 0)) return 0;
+	if (unlikely(track->key_count == 1)) return track->keys[0].value;
+
+	const auto progress = track_progress(track, t_ms);
+	const i32 from = track->keys[track->segment].value;
+	const i32 to = track->keys[track->segment + 1].value;
+	const u32 weight = progress + (progress >> 15); // 0..65536
+	return from + (i32)((((i64)to - from) * weight) >> 16);
+}
+
+u32 anim_track_eval_color(anim_track_t *track, const u32 t_ms) {
+	if (unlikely(track->key_count == 0)) return 0;
+	if (unlikely(track->key_count == 1)) return (u32)track->keys[0].value;
+
+	const auto progress = track_progress(track, t_ms);
+	const u32 from = (u32)track->keys[track->segment].value;
+	const u32 to = (u32)track->keys[track->segment + 1].value;
+	return pixels_blend_color(from, to, (progress + 128u) >> 8); // 0..256
+}
+
+i32 anim_track_value(anim_track_t *track, const u32 now_us) {
+	return anim_track_eval(track, utils_time_diff_ms(track->start_us, now_us));
+}
+
+u32 anim_track_color(anim_track_t *track, const u32 now_us) {
+	return anim_track_eval_color(track, utils_time_diff_ms(track->start_us, now_us));
+}
+
+bool anim_track_done(const anim_track_t *track, const u32 now_us) {
+	return track->loop == ANIM_LOOP_ONCE && utils_time_diff_ms(track->start_us, now_us) >= track->duration_ms;
+}
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "fixed.h"
 #include "shared_config.h"
 
 typedef enum {
@@ -27,3 +28,91 @@ u8 anim_color_reduction(const anim_direction_t direction, const u16 frame, const
 u32 anim_color_blend(const u32 color_from, const u32 color_to, const u16 frame, const u16 frame_count, const float speed, const float freq);
 
 u32 anim_reduce_brightness(const u32 reduction, const u32 color);
+
+/**
+ * Fixed point animation progress, replaces float \c speed / \c freq math - call once per frame, then use the
+ * \c _q16 variants per pixel
+ *
+ * @param speed How fast animation will go to an end (will hold), Q16
+ * @param freq How many times in frame_ticks it will get repeated, Q16
+ * @return Progress 0..Q16_ONE
+ */
+q16_t anim_phase_q16(const u16 frame, const u16 frame_count, const q16_t speed, const q16_t freq);
+
+/**
+ * Fixed point variant of \c anim_color_reduction
+ *
+ * @param phase Progress from \c anim_phase_q16
+ */
+u8 anim_color_reduction_q16(const anim_direction_t direction, const q16_t phase);
+
+/**
+ * Fixed point variant of \c anim_color_blend
+ *
+ * @param phase Progress from \c anim_phase_q16
+ */
+u32 anim_color_blend_q16(const u32 color_from, const u32 color_to, const q16_t phase);
+
+// --- easing / timeline
+
+typedef enum {
+	ANIM_EASE_LINEAR, ANIM_EASE_IN, ANIM_EASE_OUT, ANIM_EASE_IN_OUT, ANIM_EASE_SINE, ANIM_EASE_PULSE, ANIM_EASE_STEP
+} anim_ease_t;
+
+typedef enum {
+	ANIM_LOOP_ONCE, ANIM_LOOP_REPEAT, ANIM_LOOP_PING_PONG
+} anim_loop_t;
+
+typedef struct {
+	u32 time_ms; // from track start, keyframes must be sorted
+	i32 value; // brightness, position, color (see anim_track_eval_color), etc.
+	anim_ease_t ease; // curve from this keyframe to the next one
+} anim_keyframe_t;
+
+typedef struct {
+	const anim_keyframe_t *keys;
+	u16 key_count;
+	anim_loop_t loop;
+	u32 start_us;
+	u32 duration_ms;
+	// cached segment - sequential evaluation is O(1), random access falls back to binary search
+	u16 segment;
+	u32 segment_start_ms;
+	u32 segment_end_ms;
+	u32 segment_recip; // (2^32 - 1) / segment length
+} anim_track_t;
+
+/**
+ * @param t Progress 0..65535
+ * @return Eased progress 0..65535 (LUT + interpolation, PULSE goes 0 -> 65535 -> 0)
+ */
+u16 anim_ease(const anim_ease_t ease, const u16 t);
+
+void anim_track_init(anim_track_t *track, const anim_keyframe_t *keys, const u16 key_count, const anim_loop_t loop);
+
+/**
+ * Restarts the track, time is measured from \c now_us (time_us_32)
+ */
+void anim_track_start(anim_track_t *track, const u32 now_us);
+
+/**
+ * Value at arbitrary time \c t_ms since track start (loop/ping-pong applied)
+ */
+i32 anim_track_eval(anim_track_t *track, u32 t_ms);
+
+/**
+ * Same as \c anim_track_eval, but values are packed colors blended per channel
+ */
+u32 anim_track_eval_color(anim_track_t *track, u32 t_ms);
+
+/**
+ * Value for wall clock \c now_us - time based, so dropped frames don't slow the animation down
+ */
+i32 anim_track_value(anim_track_t *track, const u32 now_us);
+
+u32 anim_track_color(anim_track_t *track, const u32 now_us);
+
+/**
+ * @return \c true when \c ANIM_LOOP_ONCE track is past its last keyframe
+ */
+bool anim_track_done(const anim_track_t *track, const u32 now_us);
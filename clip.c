@@ -0,0 +1,100 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "clip.h"
+
+#include <pico/time.h>
+
+#include "utils.h"
+
+static inline u16 read_u16(const u8 *p) {
+	return (u16)(p[0] | p[1] << 8);
+}
+
+static inline u32 read_u32(const u8 *p) {
+	return p[0] | p[1] << 8 | p[2] << 16 | (u32)p[3] << 24;
+}
+
+bool clip_open(clip_player_t *player, const u8 *data, const size_t size, const bool loop) {
+	if (size < CLIP_HEADER_SIZE || data[0] != 'L' || data[1] != 'C' || data[2] != 'L' || data[3] != 'P') return false;
+	if (data[4] != CLIP_VERSION) return false;
+
+	player->end = data + size;
+	player->flags = data[5];
+	player->count = read_u16(data + 6);
+	player->frame_count = read_u16(data + 8);
+	player->frame_ms = read_u16(data + 10);
+	player->palette_size = read_u16(data + 12);
+	player->palette = data + CLIP_HEADER_SIZE;
+	player->frames = player->palette + player->palette_size * 4u;
+	player->loop = loop;
+	if (player->frames > player->end || player->palette_size > 256) return false;
+	if ((player->flags & CLIP_FLAG_PALETTE) && player->palette_size == 0) return false;
+
+	clip_rewind(player);
+	return true;
+}
+
+void clip_rewind(clip_player_t *player) {
+	player->next = player->frames;
+	player->frame = 0;
+	player->started = false;
+}
+
+bool clip_decode_next(clip_player_t *player, u32 *buffer) {
+	if (player->frame >= player->frame_count) {
+		if (!player->loop || player->frame_count == 0) return false;
+		clip_rewind(player); // frame 0 writes every pixel, so it's a clean loop point
+	}
+
+	const bool indexed = player->flags & CLIP_FLAG_PALETTE;
+	const u32 color_size = indexed ? 1 : (player->flags & CLIP_FLAG_WHITE ? 4 : 3);
+	const u8 *p = player->next;
+	const u8 *end = player->end;
+	const u32 count = player->count;
+	u32 pixel = 0;
+
+	while (true) {
+		if (unlikely(p >= end)) return false;
+		const u8 op = *p++;
+		if (op == CLIP_OP_END) break;
+
+		if (op < CLIP_OP_END) {
+			pixel += op + 1u;
+			continue;
+		}
+
+		const u32 n = (op & 0x3F) + 1u;
+		const bool run = op < CLIP_OP_LITERAL;
+		if (unlikely(pixel + n > count || p + (run ? 1 : n) * color_size > end)) return false;
+
+		for (u32 i = 0; i < n; i++) {
+			u32 color;
+			if (indexed) {
+				if (unlikely(*p >= player->palette_size)) return false; // index past the palette - corrupt
+				color = read_u32(player->palette + *p * 4u);
+			} else {
+				color = p[0] | p[1] << 8 | p[2] << 16 | (color_size == 4 ? (u32)p[3] << 24 : 0);
+			}
+			if (!run || i == n - 1) p += color_size;
+			buffer[pixel++] = color;
+		}
+	}
+
+	player->next = p;
+	player->frame++;
+	return true;
+}
+
+bool clip_update(clip_player_t *player, u32 *buffer) {
+	const u32 now = time_us_32();
+	if (player->started && (i32)(now - player->next_frame_us) < 0) return false;
+
+	if (!clip_decode_next(player, buffer)) return false;
+
+	// schedule from the previous deadline, so decode time doesn't accumulate as drift
+	if (!player->started || (i32)(now - player->next_frame_us) > (i32)player->frame_ms * 1000) player->next_frame_us = now;
+	player->next_frame_us += player->frame_ms * 1000u;
+	player->started = true;
+	return true;
+}
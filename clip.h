@@ -0,0 +1,76 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <stddef.h>
+
+#include "shared_config.h"
+
+/*
+ * Precomputed LED animation clips - delta + RLE encoded frames built offline by tools/clip_encode.py from PNG/GIF.
+ * Player decodes straight from flash (XIP) into the LED draw buffer: constant RAM (player struct only) and work
+ * proportional to changed pixels - unchanged pixels are skipped, not rewritten.
+ *
+ * Layout (little endian, byte aligned - no alignment requirements):
+ *   header   "LCLP", u8 version, u8 flags, u16 count, u16 frame_count, u16 frame_ms, u16 palette_size, u16 reserved
+ *   palette  palette_size * u32 0xWWRRGGBB
+ *   frames   ops until CLIP_OP_END, frame 0 always writes every pixel (loop point)
+ * Ops:
+ *   0x00..0x7E  skip n + 1 pixels (unchanged since previous frame)
+ *   0x7F        end of frame
+ *   0x80 | n    run - next n + 1 pixels (n <= 63) get one color
+ *   0xC0 | n    literal - n + 1 colors follow
+ * Color: palette index (u8) with CLIP_FLAG_PALETTE, otherwise B, G, R (+ W with CLIP_FLAG_WHITE) bytes
+ */
+
+#define CLIP_VERSION        1
+#define CLIP_HEADER_SIZE    16
+#define CLIP_FLAG_WHITE     0x01
+#define CLIP_FLAG_PALETTE   0x02
+#define CLIP_OP_END         0x7F
+#define CLIP_OP_RUN         0x80
+#define CLIP_OP_LITERAL     0xC0
+
+typedef struct {
+	const u8 *end;
+	const u8 *palette; // raw palette bytes in flash
+	const u8 *frames; // frame 0
+	const u8 *next; // next frame to decode
+	u16 count; // pixels per frame
+	u16 frame_count;
+	u16 frame_ms;
+	u16 palette_size;
+	u16 frame; // index of next frame
+	u8 flags;
+	bool loop;
+	bool started;
+	u32 next_frame_us;
+} clip_player_t;
+
+/**
+ * Validates header and prepares playback from frame 0
+ *
+ * @return \c false when data isn't a supported clip
+ */
+bool clip_open(clip_player_t *player, const u8 *data, size_t size, bool loop);
+
+void clip_rewind(clip_player_t *player);
+
+/**
+ * Decodes next frame into \c buffer (must hold \c count pixels and keep the previous frame - deltas build on it)
+ *
+ * @return \c false when clip is finished (not looping) or data is corrupt
+ */
+bool clip_decode_next(clip_player_t *player, u32 *buffer);
+
+/**
+ * Time based playback - decodes next frame once \c frame_ms passed since the previous one
+ *
+ * @return \c true when \c buffer was updated (present it)
+ */
+bool clip_update(clip_player_t *player, u32 *buffer);
+
+static inline bool clip_done(const clip_player_t *player) {
+	return !player->loop && player->frame >= player->frame_count;
+}
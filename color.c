@@ -0,0 +1,205 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "color.h"
+
+#include "pixels.h"
+
+#define SIMPLEX_F2 23988 // (sqrt(3) - 1) / 2, Q16
+#define SIMPLEX_G2 13849 // (3 - sqrt(3)) / 6, Q16
+#define SIMPLEX_SCALE 8890 // 70 * 127 - sum of corner contributions to +-127
+
+// rounded x / 255 for x <= 255 * 255
+static inline u32 div255(const u32 x) {
+	return ((x + 128) * 257) >> 16;
+}
+
+static inline u32 pack(const u32 r, const u32 g, const u32 b) {
+	return div255(r) << 16 | div255(g) << 8 | div255(b);
+}
+
+// lo and chroma are channel values * 255, lo + chroma <= 255 * 255
+static inline u32 hue_to_rgb(const u16 hue, const u32 lo, const u32 chroma) {
+	const u32 h6 = hue * 6u;
+	const u32 f = h6 & 0xFFFF;
+	const u32 hi = lo + chroma;
+	const u32 up = lo + (chroma * f >> 16);
+	const u32 down = lo + (chroma * (65536 - f) >> 16);
+
+	switch (h6 >> 16) {
+		case 0: return pack(hi, up, lo);
+		case 1: return pack(down, hi, lo);
+		case 2: return pack(lo, hi, up);
+		case 3: return pack(lo, down, hi);
+		case 4: return pack(up, lo, hi);
+		default: return pack(hi, lo, down);
+	}
+}
+
+u32 color_hsv16(const u16 hue, const u8 sat, const u8 val) {
+	const u32 chroma = (u32)val * sat;
+	return hue_to_rgb(hue, val * 255u - chroma, chroma);
+}
+
+u32 color_hsl16(const u16 hue, const u8 sat, const u8 light) {
+	const i32 distance = 2 * light - 255;
+	const u32 chroma = (255u - (u32)(distance < 0 ? -distance : distance)) * sat;
+	return hue_to_rgb(hue, light * 255u - chroma / 2, chroma);
+}
+
+color_hsv_t color_rgb_to_hsv(const u32 color) {
+	const i32 r = (color >> 16) & 0xFF;
+	const i32 g = (color >> 8) & 0xFF;
+	const i32 b = color & 0xFF;
+	const i32 max = r > g ? (r > b ? r : b) : (g > b ? g : b);
+	const i32 min = r < g ? (r < b ? r : b) : (g < b ? g : b);
+	const i32 delta = max - min;
+	if (delta == 0) return (color_hsv_t){ .h = 0, .s = 0, .v = (u8)max };
+
+	i32 hue;
+	if (max == r) hue = (g - b) * 10923 / delta;
+	else if (max == g) hue = COLOR_HUE_GREEN + (b - r) * 10923 / delta;
+	else hue = COLOR_HUE_BLUE + (r - g) * 10923 / delta;
+
+	return (color_hsv_t){ .h = (u16)hue, .s = (u8)((delta * 255 + max / 2) / max), .v = (u8)max };
+}
+
+void color_fill_rainbow(u32 *dst, const size_t len, const u16 hue, const i32 hue_step, const u8 sat, const u8 val) {
+	const u32 chroma = (u32)val * sat;
+	const u32 lo = val * 255u - chroma;
+	u32 h = hue;
+	for (size_t i = 0; i < len; i++) {
+		dst[i] = hue_to_rgb((u16)h, lo, chroma);
+		h += (u32)hue_step;
+	}
+}
+
+void color_palette_from_gradient(color_palette_t *palette, const color_gradient_stop_t *stops, const u32 stop_count) {
+	if (stop_count == 0) {
+		pixels_fill(palette->lut, 256, 0);
+		return;
+	}
+
+	u32 k = 0;
+	for (u32 i = 0; i < 256; i++) {
+		while (k + 1 < stop_count && stops[k + 1].pos <= i) k++;
+		const auto from = &stops[k];
+		if (i <= from->pos || k + 1 == stop_count) {
+			palette->lut[i] = from->color;
+			continue;
+		}
+		const auto to = &stops[k + 1];
+		const u32 t = ((i - from->pos) << 8) / (to->pos - from->pos);
+		palette->lut[i] = pixels_blend_color(from->color, to->color, t);
+	}
+}
+
+u32 color_palette_at16(const color_palette_t *palette, const u16 pos) {
+	const u32 index = pos >> 8;
+	return pixels_blend_color(palette->lut[index], palette->lut[(index + 1) & 0xFF], pos & 0xFF);
+}
+
+void color_fill_palette(u32 *dst, const size_t len, const color_palette_t *palette, const u16 pos, const i32 step) {
+	u32 p = pos;
+	for (size_t i = 0; i < len; i++) {
+		dst[i] = color_palette_at16(palette, (u16)p);
+		p += (u32)step;
+	}
+}
+
+// --- noise
+
+static inline u32 hash2(const u32 x, const u32 y) {
+	u32 h = x * 0x9E3779B1u ^ y * 0x85EBCA77u;
+	h ^= h >> 15;
+	h *= 0x2C1B3C6Du;
+	h ^= h >> 12;
+	h *= 0x297A2D39u;
+	h ^= h >> 15;
+	return h;
+}
+
+// 3t^2 - 2t^3, 8 bit
+static inline i32 fade8(const u32 t) {
+	return (i32)((t * t * (768 - 2 * t)) >> 16);
+}
+
+static inline i32 lerp8(const i32 a, const i32 b, const i32 t) {
+	return a + (((b - a) * t) >> 8);
+}
+
+u8 color_noise_value(const u32 x, const u32 y) {
+	const u32 ix = x >> 8;
+	const u32 iy = y >> 8;
+	const i32 fx = fade8(x & 0xFF);
+	const i32 fy = fade8(y & 0xFF);
+
+	const i32 top = lerp8((i32)(hash2(ix, iy) >> 24), (i32)(hash2(ix + 1, iy) >> 24), fx);
+	const i32 bottom = lerp8((i32)(hash2(ix, iy + 1) >> 24), (i32)(hash2(ix + 1, iy + 1) >> 24), fx);
+	return (u8)lerp8(top, bottom, fy);
+}
+
+// one of 8 gradients - axes and diagonals
+static inline i32 grad_dot(const u32 hash, const i32 x, const i32 y) {
+	switch (hash >> 29) {
+		case 0: return x + y;
+		case 1: return -x + y;
+		case 2: return x - y;
+		case 3: return -x - y;
+		case 4: return x;
+		case 5: return -x;
+		case 6: return y;
+		default: return -y;
+	}
+}
+
+// x, y - Q16 offset from corner
+static inline i32 simplex_corner(const u32 hash, const i32 x, const i32 y) {
+	const i32 t = 0x8000 - (i32)(((i64)x * x) >> 16) - (i32)(((i64)y * y) >> 16);
+	if (t <= 0) return 0;
+	const i32 t2 = (t * t) >> 16;
+	const i32 t4 = (t2 * t2) >> 16;
+	return (t4 * grad_dot(hash, x, y)) >> 16;
+}
+
+u8 color_noise_simplex(const u32 x, const u32 y) {
+	// skew to the simplex grid, 24.8 -> Q16
+	const i64 sx = (i64)x << 8;
+	const i64 sy = (i64)y << 8;
+	const i64 s = ((sx + sy) * SIMPLEX_F2) >> 16;
+	const i64 i = (sx + s) >> 16;
+	const i64 j = (sy + s) >> 16;
+	const i64 t = (i + j) * SIMPLEX_G2;
+	const i32 x0 = (i32)(sx - (i << 16) + t);
+	const i32 y0 = (i32)(sy - (j << 16) + t);
+
+	// lower or upper triangle of the cell
+	const i32 i1 = x0 > y0;
+	const i32 j1 = !i1;
+	const i32 x1 = x0 - (i1 << 16) + SIMPLEX_G2;
+	const i32 y1 = y0 - (j1 << 16) + SIMPLEX_G2;
+	const i32 x2 = x0 - 0x10000 + 2 * SIMPLEX_G2;
+	const i32 y2 = y0 - 0x10000 + 2 * SIMPLEX_G2;
+
+	const u32 ci = (u32)i;
+	const u32 cj = (u32)j;
+	const i32 n = simplex_corner(hash2(ci, cj), x0, y0) + simplex_corner(hash2(ci + i1, cj + j1), x1, y1)
+	              + simplex_corner(hash2(ci + 1, cj + 1), x2, y2);
+
+	const i32 value = 128 + ((n * SIMPLEX_SCALE) >> 16);
+	return (u8)(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+void color_fill_noise(u32 *dst, const u16 width, const u16 height, const color_palette_t *palette,
+                      const color_noise_t type, const u32 x, const u32 y, const u32 scale) {
+	for (u32 row = 0; row < height; row++) {
+		const u32 sy = y + row * scale;
+		u32 *out = &dst[row * width];
+		u32 sx = x;
+		if (type == COLOR_NOISE_SIMPLEX) {
+			for (u32 col = 0; col < width; col++, sx += scale) out[col] = palette->lut[color_noise_simplex(sx, sy)];
+		} else {
+			for (u32 col = 0; col < width; col++, sx += scale) out[col] = palette->lut[color_noise_value(sx, sy)];
+		}
+	}
+}
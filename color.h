@@ -0,0 +1,112 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <stddef.h>
+
+#include "shared_config.h"
+
+/*
+ * Integer color space and procedural effect kernels (rainbows, palettes, plasma/fire noise) - no float, no division
+ * on the per-pixel path. Colors are packed 0x00RRGGBB like the rest of the LED code.
+ * Hue is u16 - 0..65535 is one full circle (same convention as fixed.h angles), 8 bit hue variants shift it up.
+ * Noise coordinates are 24.8 fixed point - one lattice cell is 256 units, so \c step 16 moves 1/16 of a cell.
+ */
+
+#define COLOR_HUE_RED       0u
+#define COLOR_HUE_YELLOW    10923u
+#define COLOR_HUE_GREEN     21845u
+#define COLOR_HUE_CYAN      32768u
+#define COLOR_HUE_BLUE      43691u
+#define COLOR_HUE_MAGENTA   54613u
+
+typedef struct {
+	u16 h;
+	u8 s;
+	u8 v;
+} color_hsv_t;
+
+typedef struct {
+	u8 pos; // 0..255, stops sorted, first and last should be at 0 and 255
+	u32 color;
+} color_gradient_stop_t;
+
+/**
+ * 256 entry color LUT - can be handed to indexed wsleds instances directly (\c palette field)
+ */
+typedef struct {
+	u32 lut[256];
+} color_palette_t;
+
+typedef enum {
+	COLOR_NOISE_VALUE, // blocky-smooth, cheapest
+	COLOR_NOISE_SIMPLEX, // organic, no grid artifacts
+} color_noise_t;
+
+/**
+ * @param hue 0..65535 full circle
+ */
+u32 color_hsv16(u16 hue, u8 sat, u8 val);
+
+/**
+ * @param hue 0..255 full circle
+ */
+static inline u32 color_hsv(const u8 hue, const u8 sat, const u8 val) {
+	return color_hsv16((u16)(hue << 8), sat, val);
+}
+
+/**
+ * @param light 0 - black, 128 - full color (127.5 exactly, so 1/255 white in it), 255 - white
+ */
+u32 color_hsl16(u16 hue, u8 sat, u8 light);
+
+/**
+ * Inverse of \c color_hsv16 (divides - meant for setup, not per pixel). Hue is 0 for grays.
+ */
+color_hsv_t color_rgb_to_hsv(u32 color);
+
+/**
+ * Rainbow along the buffer: pixel i gets hue \c hue + i * \c hue_step
+ *
+ * @param hue_step Signed hue increment per pixel (65536 / len spreads one full circle over the buffer)
+ */
+void color_fill_rainbow(u32 *dst, size_t len, u16 hue, i32 hue_step, u8 sat, u8 val);
+
+/**
+ * Builds LUT from gradient stops (linear RGB blend between stops, flat before first / after last)
+ */
+void color_palette_from_gradient(color_palette_t *palette, const color_gradient_stop_t *stops, u32 stop_count);
+
+static inline u32 color_palette_at(const color_palette_t *palette, const u8 index) {
+	return palette->lut[index];
+}
+
+/**
+ * Sub-entry lookup - blends the two nearest LUT entries, wraps 255 -> 0 (cyclic palettes)
+ *
+ * @param pos 0..65535 whole palette
+ */
+u32 color_palette_at16(const color_palette_t *palette, u16 pos);
+
+/**
+ * Palette along the buffer: pixel i gets \c color_palette_at16(pos + i * \c step)
+ */
+void color_fill_palette(u32 *dst, size_t len, const color_palette_t *palette, u16 pos, i32 step);
+
+/**
+ * @return 0..255 value noise (hashed lattice, smoothstep interpolation)
+ */
+u8 color_noise_value(u32 x, u32 y);
+
+/**
+ * @return 0..255 simplex noise, 128 is zero crossing
+ */
+u8 color_noise_simplex(u32 x, u32 y);
+
+/**
+ * Row major width x height buffer of \c palette colors indexed by noise, pixel (col, row) samples
+ * (x + col * scale, y + row * scale). Strips use height 1 and animate with \c y (time), matrices scroll x / y.
+ */
+void color_fill_noise(u32 *dst, u16 width, u16 height, const color_palette_t *palette, color_noise_t type, u32 x,
+                      u32 y, u32 scale);
@@ -0,0 +1,149 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "fixed.h"
+
+#define FX_LOG2E_Q16        94548       // log2(e)
+#define FX_RECIP_SEED_C1    3031741621u // 48/17 in Q30
+#define FX_RECIP_SEED_C2    2021161080u // 32/17 in Q30
+
+// sin(2 * pi * i / 256) in Q15, last entry wraps for interpolation
+static const q15_t SIN_TABLE[257] = {
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+	12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+	23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+	30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+	32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285, 32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+	30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+	23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+	12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179, 6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+	0, -804, -1608, -2410, -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+	-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+	-23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+	-30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+	-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+	-30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+	-23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+	-12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+	0
+};
+
+// 2^(i / 256) in Q16, for fractional part of exp2
+static const u32 EXP2_TABLE[257] = {
+	65536, 65714, 65892, 66071, 66250, 66429, 66609, 66790, 66971, 67153, 67335, 67517,
+	67700, 67884, 68068, 68252, 68438, 68623, 68809, 68996, 69183, 69370, 69558, 69747,
+	69936, 70126, 70316, 70507, 70698, 70889, 71082, 71274, 71468, 71661, 71856, 72050,
+	72246, 72442, 72638, 72835, 73032, 73230, 73429, 73628, 73828, 74028, 74229, 74430,
+	74632, 74834, 75037, 75240, 75444, 75649, 75854, 76060, 76266, 76473, 76680, 76888,
+	77096, 77305, 77515, 77725, 77936, 78147, 78359, 78572, 78785, 78998, 79212, 79427,
+	79642, 79858, 80075, 80292, 80510, 80728, 80947, 81166, 81386, 81607, 81828, 82050,
+	82273, 82496, 82719, 82944, 83169, 83394, 83620, 83847, 84074, 84302, 84531, 84760,
+	84990, 85220, 85451, 85683, 85915, 86148, 86382, 86616, 86851, 87086, 87322, 87559,
+	87796, 88034, 88273, 88513, 88752, 88993, 89234, 89476, 89719, 89962, 90206, 90451,
+	90696, 90942, 91188, 91436, 91684, 91932, 92181, 92431, 92682, 92933, 93185, 93438,
+	93691, 93945, 94200, 94455, 94711, 94968, 95226, 95484, 95743, 96002, 96263, 96524,
+	96785, 97048, 97311, 97575, 97839, 98104, 98370, 98637, 98905, 99173, 99442, 99711,
+	99982, 100253, 100524, 100797, 101070, 101344, 101619, 101895, 102171, 102448, 102726, 103004,
+	103283, 103564, 103844, 104126, 104408, 104691, 104975, 105260, 105545, 105831, 106118, 106406,
+	106694, 106984, 107274, 107565, 107856, 108149, 108442, 108736, 109031, 109326, 109623, 109920,
+	110218, 110517, 110816, 111117, 111418, 111720, 112023, 112327, 112631, 112937, 113243, 113550,
+	113858, 114167, 114476, 114787, 115098, 115410, 115723, 116036, 116351, 116667, 116983, 117300,
+	117618, 117937, 118257, 118577, 118899, 119221, 119544, 119869, 120194, 120519, 120846, 121174,
+	121502, 121832, 122162, 122493, 122825, 123158, 123492, 123827, 124163, 124500, 124837, 125176,
+	125515, 125855, 126197, 126539, 126882, 127226, 127571, 127917, 128263, 128611, 128960, 129310,
+	129660, 130012, 130364, 130718, 131072
+};
+
+/**
+ * Normalizes v into d in [0.5, 1) (Q32) and returns 1 / d in Q30 (value in (1, 2])
+ */
+static u32 recip_normalized(const u32 v, u32 *shift) {
+	const u32 n = (u32)__builtin_clz(v);
+	const u32 d = v << n;
+	*shift = n;
+
+	// linear seed 48/17 - 32/17 * d, then three Newton iterations r = r * (2 - d * r)
+	u32 r = FX_RECIP_SEED_C1 - (u32)(((u64)FX_RECIP_SEED_C2 * d) >> 32);
+	for (u8 i = 0; i < 3; i++) {
+		const u64 dr = ((u64)d * r) >> 32; // Q30
+		const u64 two_minus = (2ull << 30) - dr;
+		r = (u32)(((u64)r * two_minus) >> 30);
+	}
+	return r;
+}
+
+q16_t fx_recip(const q16_t x) {
+	if (x == 0) return Q16_MAX;
+	const bool negative = x < 0;
+	const u32 v = negative ? (u32)0 - (u32)x : (u32)x;
+
+	u32 n;
+	const u64 r = recip_normalized(v, &n);
+	// 1 / x in Q16 = r * 2^(n - 30)
+	const u64 result = n >= 30 ? r << (n - 30) : (r + (1ull << (29 - n))) >> (30 - n);
+	if (result > INT32_MAX) return negative ? Q16_MIN : Q16_MAX;
+	return negative ? -(q16_t)result : (q16_t)result;
+}
+
+q16_t fx_div(const q16_t a, const q16_t b) {
+	if (b == 0) return a >= 0 ? Q16_MAX : Q16_MIN;
+	if (a == 0) return 0;
+
+	const bool negative = (a < 0) != (b < 0);
+	const u64 ua = a < 0 ? (u64)0 - (u64)(i64)a : (u64)a;
+	const u32 ub = b < 0 ? (u32)0 - (u32)b : (u32)b;
+
+	u32 n;
+	const u64 r = recip_normalized(ub, &n);
+	// a / b in Q16 = a * r * 2^(n - 46), rounded to nearest
+	const u32 shift = 46 - n;
+	const u64 result = (ua * r + (1ull << (shift - 1))) >> shift;
+	if (result > INT32_MAX) return negative ? Q16_MIN : Q16_MAX;
+	return negative ? -(q16_t)result : (q16_t)result;
+}
+
+q16_t fx_sqrt(const q16_t x) {
+	if (x <= 0) return 0;
+
+	// bit by bit integer sqrt of x << 16, result is Q16
+	u64 op = (u64)x << 16;
+	u64 res = 0;
+	u64 one = 1ull << 46;
+	while (one > op) one >>= 2;
+
+	while (one != 0) {
+		if (op >= res + one) {
+			op -= res + one;
+			res = (res >> 1) + one;
+		} else {
+			res >>= 1;
+		}
+		one >>= 2;
+	}
+	return (q16_t)res;
+}
+
+q16_t fx_exp2(const q16_t x) {
+	const i32 k = x >> 16; // floor
+	const u32 f = (u32)x & 0xFFFF;
+	const u32 idx = f >> 8;
+	const u32 frac = f & 0xFF;
+	const u32 m = EXP2_TABLE[idx] + (((EXP2_TABLE[idx + 1] - EXP2_TABLE[idx]) * frac) >> 8); // Q16 in [1, 2)
+
+	if (k >= 15) return Q16_MAX;
+	if (k >= 0) return (q16_t)(m << k);
+	if (k <= -18) return 0;
+	return (q16_t)(m >> -k);
+}
+
+q16_t fx_exp(const q16_t x) {
+	return fx_exp2(fx_mul_sat(x, FX_LOG2E_Q16));
+}
+
+q15_t fx_sin(const u16 angle) {
+	const u32 idx = angle >> 8;
+	const i32 frac = angle & 0xFF;
+	const i32 a = SIN_TABLE[idx];
+	const i32 b = SIN_TABLE[idx + 1];
+	return (q15_t)(a + (((b - a) * frac) >> 8));
+}
@@ -0,0 +1,150 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "shared_config.h"
+
+/*
+ * Fixed point helpers for per-frame / per-sample paths (no soft-float, no division on the hot path)
+ * q15_t - signed Q1.15, range [-1, 1)
+ * q16_t - signed Q16.16, range [-32768, 32768)
+ * Angles are u16 "turns" - 0..65535 is one full circle (FX_ANGLE_90 = quarter)
+ */
+
+typedef i16 q15_t;
+typedef i32 q16_t;
+
+#define Q15_ONE                 0x7FFF
+#define Q15_MIN                 ((q15_t)-0x8000)
+#define Q16_ONE                 ((q16_t)0x10000)
+#define Q16_HALF                ((q16_t)0x8000)
+#define Q16_MAX                 ((q16_t)0x7FFFFFFF)
+#define Q16_MIN                 ((q16_t)(-0x7FFFFFFF - 1))
+
+#define FX_ANGLE_90             16384u
+#define FX_ANGLE_180            32768u
+
+// conversions - float ones are meant for compile time constants
+#define Q16_FROM_INT(x)         ((q16_t)((i32)(x) * Q16_ONE))
+#define Q16_FROM_FLOAT(x)       ((q16_t)((x) * 65536.0f + ((x) >= 0 ? 0.5f : -0.5f)))
+#define Q16_TO_INT(x)           ((i32)(x) >> 16) // floor
+#define Q16_TO_INT_ROUND(x)     ((i32)((x) + Q16_HALF) >> 16)
+#define Q16_TO_FLOAT(x)         ((float)(x) * (1.0f / 65536.0f))
+#define Q16_FRAC(x)             ((x) & 0xFFFF)
+#define Q16_FROM_RATIO(n, d)    ((q16_t)(((i64)(n) * Q16_ONE) / (d)))
+
+#define Q15_FROM_FLOAT(x)       ((q15_t)((x) >= 0.99997f ? Q15_ONE : (x) * 32768.0f + ((x) >= 0 ? 0.5f : -0.5f)))
+#define Q15_TO_FLOAT(x)         ((float)(x) * (1.0f / 32768.0f))
+#define Q15_TO_Q16(x)           ((q16_t)(x) * 2)
+
+static inline i32 fx_sat_i64(const i64 x) {
+	if (x > INT32_MAX) return INT32_MAX;
+	if (x < INT32_MIN) return INT32_MIN;
+	return (i32)x;
+}
+
+static inline q15_t fx_q16_to_q15(const q16_t x) {
+	const i32 v = x >> 1;
+	if (v > Q15_ONE) return Q15_ONE;
+	if (v < Q15_MIN) return Q15_MIN;
+	return (q15_t)v;
+}
+
+// --- Q16.16
+
+static inline q16_t fx_mul(const q16_t a, const q16_t b) {
+	return (q16_t)(((i64)a * b) >> 16);
+}
+
+static inline q16_t fx_mul_sat(const q16_t a, const q16_t b) {
+	return fx_sat_i64(((i64)a * b) >> 16);
+}
+
+static inline q16_t fx_add_sat(const q16_t a, const q16_t b) {
+	return fx_sat_i64((i64)a + b);
+}
+
+static inline q16_t fx_sub_sat(const q16_t a, const q16_t b) {
+	return fx_sat_i64((i64)a - b);
+}
+
+static inline q16_t fx_abs(const q16_t x) {
+	return x < 0 ? (x == Q16_MIN ? Q16_MAX : -x) : x;
+}
+
+static inline q16_t fx_clamp(const q16_t x, const q16_t lo, const q16_t hi) {
+	return x < lo ? lo : (x > hi ? hi : x);
+}
+
+/**
+ * @param t 0..Q16_ONE
+ */
+static inline q16_t fx_lerp(const q16_t a, const q16_t b, const q16_t t) {
+	return a + (q16_t)(((i64)(b - a) * t) >> 16);
+}
+
+/**
+ * Scales integer by Q16 fraction - \c number * \c fraction without float
+ */
+static inline i32 fx_scale(const i32 number, const q16_t fraction) {
+	return (i32)(((i64)number * fraction) >> 16);
+}
+
+/**
+ * @return 1 / x (Newton-Raphson, no division instruction); saturates when x is 0 or too small
+ */
+q16_t fx_recip(q16_t x);
+
+/**
+ * @return a / b (reciprocal based, no division instruction); saturates on overflow and when b is 0
+ */
+q16_t fx_div(q16_t a, q16_t b);
+
+/**
+ * @return sqrt(x), 0 for x <= 0
+ */
+q16_t fx_sqrt(q16_t x);
+
+/**
+ * @return 2^x (table + interpolation), saturates at Q16_MAX
+ */
+q16_t fx_exp2(q16_t x);
+
+/**
+ * @return e^x (table + interpolation), saturates at Q16_MAX
+ */
+q16_t fx_exp(q16_t x);
+
+/**
+ * @param angle 0..65535 is full circle
+ */
+q15_t fx_sin(u16 angle);
+
+static inline q15_t fx_cos(const u16 angle) {
+	return fx_sin((u16)(angle + FX_ANGLE_90));
+}
+
+// --- Q1.15
+
+static inline q15_t fx_q15_add_sat(const q15_t a, const q15_t b) {
+	const i32 v = (i32)a + b;
+	if (v > Q15_ONE) return Q15_ONE;
+	if (v < Q15_MIN) return Q15_MIN;
+	return (q15_t)v;
+}
+
+static inline q15_t fx_q15_sub_sat(const q15_t a, const q15_t b) {
+	const i32 v = (i32)a - b;
+	if (v > Q15_ONE) return Q15_ONE;
+	if (v < Q15_MIN) return Q15_MIN;
+	return (q15_t)v;
+}
+
+/**
+ * Rounded Q15 multiply, saturates -1 * -1
+ */
+static inline q15_t fx_q15_mul(const q15_t a, const q15_t b) {
+	const i32 v = ((i32)a * b + (1 << 14)) >> 15;
+	return v > Q15_ONE ? Q15_ONE : (q15_t)v;
+}
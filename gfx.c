@@ -0,0 +1,188 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "gfx.h"
+
+#include <stdlib.h>
+
+#include "pixels.h"
+#include "utils.h"
+
+void gfx_canvas_init(gfx_canvas_t *canvas, u32 *buffer, const u16 width, const u16 height) {
+	canvas->buffer = buffer;
+	canvas->width = width;
+	canvas->height = height;
+	gfx_reset_clip(canvas);
+}
+
+void gfx_set_clip(gfx_canvas_t *canvas, const i32 x, const i32 y, const i32 width, const i32 height) {
+	canvas->clip_x0 = utils_max(x, (i32)0);
+	canvas->clip_y0 = utils_max(y, (i32)0);
+	canvas->clip_x1 = utils_min(x + width, (i32)canvas->width);
+	canvas->clip_y1 = utils_min(y + height, (i32)canvas->height);
+}
+
+void gfx_reset_clip(gfx_canvas_t *canvas) {
+	gfx_set_clip(canvas, 0, 0, canvas->width, canvas->height);
+}
+
+u32 gfx_get_pixel(const gfx_canvas_t *canvas, const i32 x, const i32 y) {
+	if (x < 0 || y < 0 || x >= canvas->width || y >= canvas->height) return 0;
+	return canvas->buffer[y * canvas->width + x];
+}
+
+void gfx_fill_rect(const gfx_canvas_t *canvas, i32 x, i32 y, const i32 width, const i32 height, const u32 color) {
+	const i32 x1 = utils_min(x + width, canvas->clip_x1);
+	const i32 y1 = utils_min(y + height, canvas->clip_y1);
+	x = utils_max(x, canvas->clip_x0);
+	y = utils_max(y, canvas->clip_y0);
+	if (x >= x1 || y >= y1) return;
+
+	for (; y < y1; y++) pixels_fill(&canvas->buffer[y * canvas->width + x], x1 - x, color);
+}
+
+void gfx_clear(const gfx_canvas_t *canvas, const u32 color) {
+	gfx_fill_rect(canvas, canvas->clip_x0, canvas->clip_y0, canvas->clip_x1 - canvas->clip_x0,
+	              canvas->clip_y1 - canvas->clip_y0, color);
+}
+
+void gfx_line(const gfx_canvas_t *canvas, i32 x0, i32 y0, const i32 x1, const i32 y1, const u32 color) {
+	if (y0 == y1) {
+		gfx_fill_rect(canvas, utils_min(x0, x1), y0, abs(x1 - x0) + 1, 1, color);
+		return;
+	}
+	if (x0 == x1) {
+		gfx_fill_rect(canvas, x0, utils_min(y0, y1), 1, abs(y1 - y0) + 1, color);
+		return;
+	}
+
+	// Bresenham
+	const i32 dx = abs(x1 - x0);
+	const i32 dy = -abs(y1 - y0);
+	const i32 sx = x0 < x1 ? 1 : -1;
+	const i32 sy = y0 < y1 ? 1 : -1;
+	i32 err = dx + dy;
+
+	while (true) {
+		gfx_pixel(canvas, x0, y0, color);
+		if (x0 == x1 && y0 == y1) break;
+		const i32 e2 = 2 * err;
+		if (e2 >= dy) {
+			err += dy;
+			x0 += sx;
+		}
+		if (e2 <= dx) {
+			err += dx;
+			y0 += sy;
+		}
+	}
+}
+
+void gfx_rect(const gfx_canvas_t *canvas, const i32 x, const i32 y, const i32 width, const i32 height,
+              const u32 color) {
+	if (width <= 0 || height <= 0) return;
+	gfx_fill_rect(canvas, x, y, width, 1, color);
+	gfx_fill_rect(canvas, x, y + height - 1, width, 1, color);
+	gfx_fill_rect(canvas, x, y + 1, 1, height - 2, color);
+	gfx_fill_rect(canvas, x + width - 1, y + 1, 1, height - 2, color);
+}
+
+void gfx_sprite(const gfx_canvas_t *canvas, const i32 x, const i32 y, const u32 *pixels, const u16 width,
+                const u16 height, const u32 transparent) {
+	const i32 from_x = utils_max(canvas->clip_x0 - x, (i32)0);
+	const i32 from_y = utils_max(canvas->clip_y0 - y, (i32)0);
+	const i32 to_x = utils_min(canvas->clip_x1 - x, (i32)width);
+	const i32 to_y = utils_min(canvas->clip_y1 - y, (i32)height);
+
+	for (i32 sy = from_y; sy < to_y; sy++) {
+		const u32 *src = &pixels[sy * width];
+		const i32 row = (y + sy) * canvas->width + x;
+		for (i32 sx = from_x; sx < to_x; sx++) {
+			if (src[sx] != transparent) canvas->buffer[row + sx] = src[sx];
+		}
+	}
+}
+
+void gfx_bitmap(const gfx_canvas_t *canvas, const i32 x, const i32 y, const u8 *columns, const u16 width,
+                const u8 height, const u32 color) {
+	const i32 from_x = utils_max(canvas->clip_x0 - x, (i32)0);
+	const i32 to_x = utils_min(canvas->clip_x1 - x, (i32)width);
+	const i32 from_y = utils_max(canvas->clip_y0 - y, (i32)0);
+	const i32 to_y = utils_min(canvas->clip_y1 - y, (i32)height);
+	if (from_y >= to_y) return;
+	const u32 row_mask = ((1u << to_y) - 1) & ~((1u << from_y) - 1);
+
+	for (i32 col = from_x; col < to_x; col++) {
+		u32 bits = columns[col] & row_mask;
+		while (bits) {
+			const i32 row = __builtin_ctz(bits);
+			bits &= bits - 1;
+			canvas->buffer[(y + row) * canvas->width + x + col] = color;
+		}
+	}
+}
+
+static inline const u8 *glyph(const gfx_font_t *font, const char c) {
+	const u32 index = (u8)c - font->first;
+	return index < font->count ? &font->columns[index * font->width] : nullptr;
+}
+
+i32 gfx_char(const gfx_canvas_t *canvas, const gfx_font_t *font, const i32 x, const i32 y, const char c,
+             const u32 color) {
+	const auto columns = glyph(font, c);
+	if (columns != nullptr) gfx_bitmap(canvas, x, y, columns, font->width, font->height, color);
+	return font->width + font->spacing;
+}
+
+i32 gfx_text(const gfx_canvas_t *canvas, const gfx_font_t *font, const i32 x, const i32 y, const char *text,
+             const u32 color) {
+	i32 cursor = x;
+	for (; *text; text++) {
+		if (cursor >= canvas->clip_x1) break;
+		cursor += gfx_char(canvas, font, cursor, y, *text, color);
+	}
+	return cursor - x;
+}
+
+i32 gfx_text_width(const gfx_font_t *font, const char *text) {
+	i32 width = 0;
+	for (; *text; text++) width += font->width + font->spacing;
+	return width;
+}
+
+static inline void add_pixel(const gfx_canvas_t *canvas, const i32 x, const i32 y, const u32 color) {
+	if (!gfx_in_clip(canvas, x, y)) return;
+	u32 *dst = &canvas->buffer[y * canvas->width + x];
+	*dst = pixels_add_color(*dst, color);
+}
+
+void gfx_text_subpixel(const gfx_canvas_t *canvas, const gfx_font_t *font, const i32 x_q8, const i32 y,
+                       const char *text, const u32 color) {
+	const i32 x = x_q8 >> 8; // floor, also for negative
+	const u32 frac = x_q8 & 0xFF;
+	if (frac == 0) {
+		gfx_text(canvas, font, x, y, text, color);
+		return;
+	}
+
+	const u32 left = pixels_scale_color(color, 256 - frac);
+	const u32 right = pixels_scale_color(color, frac);
+	const i32 advance = font->width + font->spacing;
+
+	i32 cursor = x;
+	for (; *text && cursor < canvas->clip_x1; text++, cursor += advance) {
+		if (cursor + advance < canvas->clip_x0) continue;
+		const auto columns = glyph(font, *text);
+		if (columns == nullptr) continue;
+
+		for (i32 col = 0; col < font->width; col++) {
+			u32 bits = columns[col];
+			while (bits) {
+				const i32 row = __builtin_ctz(bits);
+				bits &= bits - 1;
+				add_pixel(canvas, cursor + col, y + row, left);
+				add_pixel(canvas, cursor + col + 1, y + row, right);
+			}
+		}
+	}
+}
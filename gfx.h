@@ -0,0 +1,99 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "shared_config.h"
+
+/*
+ * Small 2D blitter for LED matrices - draws into any row major u32 buffer (e.g. wsleds buffer with geometry set).
+ * Everything is clipped to the canvas clip rectangle, coordinates may be negative or past the edge.
+ * Fonts and bitmaps are 1 bit per pixel, column major - one byte per column, bit 0 is the top row (height <= 8).
+ */
+
+typedef struct {
+	u32 *buffer;
+	u16 width;
+	u16 height;
+	i32 clip_x0; // inclusive
+	i32 clip_y0;
+	i32 clip_x1; // exclusive
+	i32 clip_y1;
+} gfx_canvas_t;
+
+typedef struct {
+	const u8 *columns; // width bytes per glyph
+	u8 width;
+	u8 height; // <= 8
+	u8 spacing; // empty columns after each glyph
+	u8 first; // first character in the table
+	u8 count;
+} gfx_font_t;
+
+extern const gfx_font_t GFX_FONT_5X7; // printable ASCII 0x20..0x7E
+extern const gfx_font_t GFX_FONT_DIGITS_8X8; // 0..9, full 8x8 frames (former WSLEDS_NUMBERS)
+
+void gfx_canvas_init(gfx_canvas_t *canvas, u32 *buffer, u16 width, u16 height);
+
+void gfx_set_clip(gfx_canvas_t *canvas, i32 x, i32 y, i32 width, i32 height);
+
+void gfx_reset_clip(gfx_canvas_t *canvas);
+
+static inline bool gfx_in_clip(const gfx_canvas_t *canvas, const i32 x, const i32 y) {
+	return x >= canvas->clip_x0 && x < canvas->clip_x1 && y >= canvas->clip_y0 && y < canvas->clip_y1;
+}
+
+static inline void gfx_pixel(const gfx_canvas_t *canvas, const i32 x, const i32 y, const u32 color) {
+	if (gfx_in_clip(canvas, x, y)) canvas->buffer[y * canvas->width + x] = color;
+}
+
+/**
+ * @return Pixel color, 0 outside of canvas
+ */
+u32 gfx_get_pixel(const gfx_canvas_t *canvas, i32 x, i32 y);
+
+/**
+ * Fills clip rectangle
+ */
+void gfx_clear(const gfx_canvas_t *canvas, u32 color);
+
+void gfx_line(const gfx_canvas_t *canvas, i32 x0, i32 y0, i32 x1, i32 y1, u32 color);
+
+void gfx_rect(const gfx_canvas_t *canvas, i32 x, i32 y, i32 width, i32 height, u32 color);
+
+void gfx_fill_rect(const gfx_canvas_t *canvas, i32 x, i32 y, i32 width, i32 height, u32 color);
+
+/**
+ * Copies color sprite, pixels equal to \c transparent are skipped
+ *
+ * @param pixels row major \c width * \c height
+ */
+void gfx_sprite(const gfx_canvas_t *canvas, i32 x, i32 y, const u32 *pixels, u16 width, u16 height,
+                u32 transparent);
+
+/**
+ * Draws set bits of 1 bit column major bitmap with \c color, clear bits are left untouched
+ */
+void gfx_bitmap(const gfx_canvas_t *canvas, i32 x, i32 y, const u8 *columns, u16 width, u8 height, u32 color);
+
+/**
+ * @return Advance in pixels (glyph width + spacing), characters outside of font are drawn as blank
+ */
+i32 gfx_char(const gfx_canvas_t *canvas, const gfx_font_t *font, i32 x, i32 y, char c, u32 color);
+
+/**
+ * @return Width of drawn text in pixels (incl. trailing spacing)
+ */
+i32 gfx_text(const gfx_canvas_t *canvas, const gfx_font_t *font, i32 x, i32 y, const char *text, u32 color);
+
+i32 gfx_text_width(const gfx_font_t *font, const char *text);
+
+/**
+ * Sub-pixel positioned text for smooth scrolling - every lit pixel is split between two columns by the fractional
+ * part of \c x_q8 and added (saturating) to what's already there
+ * @attention Additive - clear the text area first
+ *
+ * @param x_q8 x in 24.8 fixed point (e.g. decrease by 64 per frame to scroll a quarter pixel per frame)
+ */
+void gfx_text_subpixel(const gfx_canvas_t *canvas, const gfx_font_t *font, i32 x_q8, i32 y, const char *text,
+                       u32 color);
@@ -0,0 +1,35 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "pixels.h"
+
+void pixels_fill(u32 *dst, const size_t len, const u32 color) {
+	for (size_t i = 0; i < len; i++) dst[i] = color;
+}
+
+void pixels_scale(u32 *dst, const size_t len, const u32 scale) {
+	if (scale >= 256) return;
+	if (scale == 0) {
+		pixels_fill(dst, len, 0);
+		return;
+	}
+	for (size_t i = 0; i < len; i++) dst[i] = pixels_scale_color(dst[i], scale);
+}
+
+void pixels_blend(u32 *dst, const u32 *a, const u32 *b, const size_t len, const u32 t) {
+	for (size_t i = 0; i < len; i++) dst[i] = pixels_blend_color(a[i], b[i], t);
+}
+
+void pixels_add_saturating(u32 *dst, const u32 *src, const size_t len) {
+	for (size_t i = 0; i < len; i++) dst[i] = pixels_add_color(dst[i], src[i]);
+}
+
+void pixels_sub_saturating(u32 *dst, const size_t len, const u8 amount) {
+	if (amount == 0) return;
+	const u32 packed = amount * 0x01010101u;
+	for (size_t i = 0; i < len; i++) dst[i] = pixels_sub_color(dst[i], packed);
+}
+
+void pixels_fade_to_black(u32 *dst, const size_t len, const u8 amount) {
+	pixels_scale(dst, len, 256u - amount);
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <stddef.h>
+
+#include "shared_config.h"
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include <arm_acle.h>
+#define PIXELS_DSP 1
+#else
+#define PIXELS_DSP 0
+#endif
+
+/*
+ * Packed pixel kernels - every byte of the u32 is a channel (works for 0x00RRGGBB and 32 bit RGBW/GRBW words alike).
+ * Per-word helpers are SWAR (two channels per multiply), add/sub/max use Cortex-M33 DSP (UQADD8/UQSUB8/SEL) when
+ * available. Plain C fallbacks give the exact same result bit for bit.
+ * Scale/blend factors are 0..256 where 256 is 1.0 (exact identity).
+ */
+
+#define PIXELS_MASK_02 0x00FF00FFu
+#define PIXELS_MASK_13 0xFF00FF00u
+
+/**
+ * Each channel: c * scale >> 8
+ *
+ * @param scale 0..256
+ */
+static inline u32 pixels_scale_color(const u32 color, const u32 scale) {
+	const u32 rb = ((color & PIXELS_MASK_02) * scale >> 8) & PIXELS_MASK_02;
+	const u32 ga = (((color >> 8) & PIXELS_MASK_02) * scale) & PIXELS_MASK_13;
+	return rb | ga;
+}
+
+/**
+ * Each channel: (a * (256 - t) + b * t) >> 8
+ *
+ * @param t 0..256 (0 - \c a, 256 - \c b)
+ */
+static inline u32 pixels_blend_color(const u32 a, const u32 b, const u32 t) {
+	const u32 inv = 256u - t;
+	const u32 rb = (((a & PIXELS_MASK_02) * inv + (b & PIXELS_MASK_02) * t) >> 8) & PIXELS_MASK_02;
+	const u32 ga = (((a >> 8) & PIXELS_MASK_02) * inv + ((b >> 8) & PIXELS_MASK_02) * t) & PIXELS_MASK_13;
+	return rb | ga;
+}
+
+/**
+ * Each channel: min(a + b, 255)
+ */
+static inline u32 pixels_add_color(const u32 a, const u32 b) {
+#if PIXELS_DSP
+	return __uqadd8(a, b);
+#else
+	const u32 sum = ((a & 0x7F7F7F7Fu) + (b & 0x7F7F7F7Fu)) ^ ((a ^ b) & 0x80808080u);
+	const u32 overflow = ((a & b) | ((a | b) & ~sum)) & 0x80808080u;
+	return sum | ((overflow >> 7) * 0xFFu);
+#endif
+}
+
+/**
+ * Each channel: max(a - b, 0)
+ */
+static inline u32 pixels_sub_color(const u32 a, const u32 b) {
+#if PIXELS_DSP
+	return __uqsub8(a, b);
+#else
+	const u32 diff = ((a | 0x80808080u) - (b & 0x7F7F7F7Fu)) ^ ((a ^ ~b) & 0x80808080u);
+	const u32 borrow = ((~a & b) | (~(a ^ b) & diff)) & 0x80808080u;
+	return diff & ~((borrow >> 7) * 0xFFu);
+#endif
+}
+
+/**
+ * Each channel: max(a, b)
+ */
+static inline u32 pixels_max_color(const u32 a, const u32 b) {
+#if PIXELS_DSP
+	(void)__usub8(a, b); // sets GE flags per byte where a >= b
+	return __sel(a, b);
+#else
+	// a - sat(a - b) = min(a, b), so b + sat(a - b) = max(a, b) without overflow
+	return pixels_sub_color(a, b) + b;
+#endif
+}
+
+/**
+ * Each channel: a * b / 255 (multiply blend, white keeps the other color)
+ */
+static inline u32 pixels_multiply_color(const u32 a, const u32 b) {
+	u32 result = 0;
+	for (u32 shift = 0; shift < 32; shift += 8) {
+		const u32 x = ((a >> shift) & 0xFFu) * ((b >> shift) & 0xFFu);
+		result |= ((x + (x >> 8) + 1u) >> 8) << shift; // exact x / 255 for x <= 255 * 255
+	}
+	return result;
+}
+
+void pixels_fill(u32 *dst, size_t len, u32 color);
+
+/**
+ * @param scale 0..256
+ */
+void pixels_scale(u32 *dst, size_t len, u32 scale);
+
+/**
+ * dst = blend(a, b, t) - \c dst may alias \c a or \c b
+ *
+ * @param t 0..256
+ */
+void pixels_blend(u32 *dst, const u32 *a, const u32 *b, size_t len, u32 t);
+
+/**
+ * dst = saturating dst + src
+ */
+void pixels_add_saturating(u32 *dst, const u32 *src, size_t len);
+
+/**
+ * Subtracts \c amount from every channel (buffer version of \c anim_reduce_brightness)
+ */
+void pixels_sub_saturating(u32 *dst, size_t len, u8 amount);
+
+/**
+ * Multiplicative fade - 0 keeps the buffer, 255 is black
+ */
+void pixels_fade_to_black(u32 *dst, size_t len, u8 amount);
@@ -0,0 +1,89 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "rng.h"
+
+#include <pico/platform.h>
+#include <pico/rand.h>
+#include <string.h>
+
+#include "utils.h"
+
+static rng_state_t core_states[NUM_CORES] = { };
+static bool core_seeded[NUM_CORES] = { };
+
+static inline u64 splitmix64(u64 *x) {
+	u64 z = (*x += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+void rng_seed(rng_state_t *state, u64 seed) {
+	const u64 a = splitmix64(&seed);
+	const u64 b = splitmix64(&seed);
+	state->s[0] = (u32)a;
+	state->s[1] = (u32)(a >> 32);
+	state->s[2] = (u32)b;
+	state->s[3] = (u32)(b >> 32);
+	// all zero state is the only invalid one, splitmix can't realistically produce it, but be sure
+	if ((state->s[0] | state->s[1] | state->s[2] | state->s[3]) == 0) state->s[0] = 1;
+}
+
+rng_state_t *rng_core_state() {
+	const auto core = get_core_num();
+	if (unlikely(!core_seeded[core])) {
+		rng_seed(&core_states[core], get_rand_64());
+		core_seeded[core] = true;
+	}
+	return &core_states[core];
+}
+
+u32 rng_u32() {
+	return rng_next(rng_core_state());
+}
+
+u32 rng_range(u32 from_inclusive, u32 to_inclusive) {
+	if (from_inclusive > to_inclusive) utils_swap(&from_inclusive, &to_inclusive);
+
+	const u32 range = to_inclusive - from_inclusive + 1; // wraps to 0 for full range
+	return from_inclusive + rng_next_bounded(rng_core_state(), range);
+}
+
+float rng_float() {
+	return (float)(rng_u32() >> 8) * 0x1p-24f; // 24 bits fit float mantissa exactly
+}
+
+void rng_fill_bytes(u8 *buffer, const size_t len) {
+	auto state = rng_core_state();
+	size_t i = 0;
+	for (; i + 4 <= len; i += 4) {
+		const u32 r = rng_next(state);
+		memcpy(buffer + i, &r, 4);
+	}
+	if (i < len) {
+		const u32 r = rng_next(state);
+		memcpy(buffer + i, &r, len - i);
+	}
+}
+
+void rng_fill_floats(float *buffer, const size_t len) {
+	auto state = rng_core_state();
+	for (size_t i = 0; i < len; i++) buffer[i] = (float)(rng_next(state) >> 8) * 0x1p-24f;
+}
+
+void rng_fill_range(u32 *buffer, const size_t len, u32 from_inclusive, u32 to_inclusive) {
+	if (from_inclusive > to_inclusive) utils_swap(&from_inclusive, &to_inclusive);
+
+	auto state = rng_core_state();
+	const u32 range = to_inclusive - from_inclusive + 1;
+	for (size_t i = 0; i < len; i++) buffer[i] = from_inclusive + rng_next_bounded(state, range);
+}
+
+void rng_fill_range_u8(u8 *buffer, const size_t len, u8 from_inclusive, u8 to_inclusive) {
+	if (from_inclusive > to_inclusive) utils_swap(&from_inclusive, &to_inclusive);
+
+	auto state = rng_core_state();
+	const u32 range = (u32)(to_inclusive - from_inclusive) + 1;
+	for (size_t i = 0; i < len; i++) buffer[i] = (u8)(from_inclusive + rng_next_bounded(state, range));
+}
@@ -0,0 +1,89 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <stddef.h>
+
+#include "shared_config.h"
+
+/*
+ * Fast non-cryptographic PRNG (xoshiro128++) for animations, jitter, sparkles, etc.
+ * Each core gets its own state, lazily seeded from the hardware TRNG (get_rand_64) on first use.
+ * Anything security sensitive (ids, keys, nonces) should keep using utils_random_* (hardware TRNG).
+ */
+
+typedef struct {
+	u32 s[4];
+} rng_state_t;
+
+static inline u32 rng_rotl(const u32 x, const u32 k) {
+	return (x << k) | (x >> (32 - k));
+}
+
+static inline u32 rng_next(rng_state_t *state) {
+	u32 *s = state->s;
+	const u32 result = rng_rotl(s[0] + s[3], 7) + s[0];
+	const u32 t = s[1] << 9;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = rng_rotl(s[3], 11);
+
+	return result;
+}
+
+/**
+ * Unbiased random number in [0, range) using Lemire's multiply-shift (division only on the rare rejection path)
+ *
+ * @param range 0 means full 32 bit range
+ */
+static inline u32 rng_next_bounded(rng_state_t *state, const u32 range) {
+	u32 x = rng_next(state);
+	if (__builtin_expect(range == 0, 0)) return x;
+
+	u64 m = (u64)x * range;
+	u32 low = (u32)m;
+	if (__builtin_expect(low < range, 0)) {
+		const u32 threshold = -range % range;
+		while (low < threshold) {
+			x = rng_next(state);
+			m = (u64)x * range;
+			low = (u32)m;
+		}
+	}
+	return (u32)(m >> 32);
+}
+
+/**
+ * Seeds state deterministically (splitmix64 expansion) - useful for reproducible effects
+ */
+void rng_seed(rng_state_t *state, u64 seed);
+
+/**
+ * @return State of the calling core (seeded from hardware TRNG on first call)
+ */
+rng_state_t *rng_core_state();
+
+u32 rng_u32();
+
+u32 rng_range(u32 from_inclusive, u32 to_inclusive);
+
+/**
+ * @return float in [0, 1)
+ */
+float rng_float();
+
+void rng_fill_bytes(u8 *buffer, size_t len);
+
+/**
+ * Fills with floats in [0, 1)
+ */
+void rng_fill_floats(float *buffer, size_t len);
+
+void rng_fill_range(u32 *buffer, size_t len, u32 from_inclusive, u32 to_inclusive);
+
+void rng_fill_range_u8(u8 *buffer, size_t len, u8 from_inclusive, u8 to_inclusive);
@@ -0,0 +1,202 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "compositor.h"
+
+#include <pico/multicore.h>
+#include <pico/time.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#include "pixels.h"
+#include "utils.h"
+
+static_assert((MOD_COMPOSITOR_MAILBOX_SIZE & (MOD_COMPOSITOR_MAILBOX_SIZE - 1)) == 0);
+
+typedef enum {
+	MSG_LAYER, MSG_OPACITY, MSG_BLEND, MSG_ENABLED, MSG_PARAM
+} message_type_t;
+
+typedef struct {
+	message_type_t type;
+	u8 layer;
+	u32 value;
+	compositor_render_t render;
+	void *user_data;
+} message_t;
+
+typedef struct {
+	compositor_render_t render;
+	void *user_data;
+	u32 param;
+	u8 opacity;
+	compositor_blend_t blend;
+	bool enabled;
+} layer_t;
+
+// core1 state - core0 only touches it before compositor_start
+static wsleds_t *target = nullptr;
+static u16 width = 0;
+static u16 height = 0;
+static layer_t layers[MOD_COMPOSITOR_MAX_LAYERS] = { };
+static u32 layer_buffers[MOD_COMPOSITOR_MAX_LAYERS][MOD_COMPOSITOR_MAX_LEDS] = { };
+static u32 period_us = 0;
+static u32 frame = 0;
+static volatile compositor_stats_t stats = { };
+
+// SPSC ring - head written by core0 only, tail by core1 only
+static message_t mailbox[MOD_COMPOSITOR_MAILBOX_SIZE] = { };
+static atomic_uint mailbox_head = 0;
+static atomic_uint mailbox_tail = 0;
+
+static bool post(const message_t *message) {
+	if (message->layer >= MOD_COMPOSITOR_MAX_LAYERS) return false;
+	const u32 head = atomic_load_explicit(&mailbox_head, memory_order_relaxed);
+	const u32 tail = atomic_load_explicit(&mailbox_tail, memory_order_acquire);
+	if (head - tail == MOD_COMPOSITOR_MAILBOX_SIZE) return false;
+
+	mailbox[head & (MOD_COMPOSITOR_MAILBOX_SIZE - 1)] = *message;
+	atomic_store_explicit(&mailbox_head, head + 1, memory_order_release); // publishes the slot
+	return true;
+}
+
+static void apply_messages() {
+	const u32 head = atomic_load_explicit(&mailbox_head, memory_order_acquire);
+	u32 tail = atomic_load_explicit(&mailbox_tail, memory_order_relaxed);
+
+	for (; tail != head; tail++) {
+		const message_t *message = &mailbox[tail & (MOD_COMPOSITOR_MAILBOX_SIZE - 1)];
+		layer_t *layer = &layers[message->layer];
+		switch (message->type) {
+			case MSG_LAYER:
+				layer->render = message->render;
+				layer->user_data = message->user_data;
+				layer->enabled = message->render != nullptr;
+				memset(layer_buffers[message->layer], 0, sizeof layer_buffers[0]);
+				break;
+			case MSG_OPACITY: layer->opacity = (u8)message->value;
+				break;
+			case MSG_BLEND: layer->blend = (compositor_blend_t)message->value;
+				break;
+			case MSG_ENABLED: layer->enabled = message->value && layer->render != nullptr;
+				break;
+			case MSG_PARAM: layer->param = message->value;
+				break;
+		}
+	}
+	atomic_store_explicit(&mailbox_tail, tail, memory_order_release); // slots free for core0 again
+}
+
+// src over dst, t 0..256
+static void composite(u32 *dst, const u32 *src, const u32 count, const compositor_blend_t blend, const u32 t) {
+	switch (blend) {
+		case COMPOSITOR_BLEND_NORMAL:
+			if (t == 256) memcpy(dst, src, count * sizeof(u32));
+			else pixels_blend(dst, dst, src, count, t);
+			break;
+		case COMPOSITOR_BLEND_KEYED:
+			for (u32 i = 0; i < count; i++) {
+				if (src[i] != 0) dst[i] = pixels_blend_color(dst[i], src[i], t);
+			}
+			break;
+		case COMPOSITOR_BLEND_ADD:
+			for (u32 i = 0; i < count; i++) dst[i] = pixels_add_color(dst[i], pixels_scale_color(src[i], t));
+			break;
+		case COMPOSITOR_BLEND_MULTIPLY:
+			for (u32 i = 0; i < count; i++) {
+				dst[i] = pixels_blend_color(dst[i], pixels_multiply_color(dst[i], src[i]), t);
+			}
+			break;
+		case COMPOSITOR_BLEND_MAX:
+			for (u32 i = 0; i < count; i++) dst[i] = pixels_max_color(dst[i], pixels_scale_color(src[i], t));
+			break;
+	}
+}
+
+void compositor_render_frame(u32 *out) {
+	apply_messages();
+
+	const u32 count = (u32)width * height;
+	pixels_fill(out, count, 0);
+	for (u32 i = 0; i < MOD_COMPOSITOR_MAX_LAYERS; i++) {
+		const layer_t *layer = &layers[i];
+		if (!layer->enabled || layer->opacity == 0) continue;
+
+		layer->render(layer_buffers[i], width, height, frame, layer->param, layer->user_data);
+		composite(out, layer_buffers[i], count, layer->blend, layer->opacity + (layer->opacity >> 7)); // 255 -> 256
+	}
+	frame++;
+}
+
+[[noreturn]]
+static void core1_main() {
+	u64 next_us = time_us_64();
+	for (;;) {
+		const u64 start_us = time_us_64();
+		compositor_render_frame(target->buffer);
+		// line state is advanced by core0 IRQ/alarm - present only on idle line, so there's no cross-core pending frame
+		if (!target->auto_refresh) wsleds_instance_wait_idle(target);
+		wsleds_instance_present(target);
+
+		const u64 now_us = time_us_64();
+		stats.busy_us = (u32)(now_us - start_us);
+		stats.frames++;
+		next_us += period_us;
+		if (now_us >= next_us) {
+			stats.overruns++;
+			next_us = now_us; // don't try to catch up
+			continue;
+		}
+		sleep_us(next_us - now_us);
+	}
+}
+
+void compositor_init(wsleds_t *leds, const u16 w, const u16 h) {
+	if ((u32)w * h > MOD_COMPOSITOR_MAX_LEDS || (leds != nullptr && (u32)w * h != leds->count)) utils_error_mode(30);
+
+	target = leds;
+	width = w;
+	height = h;
+	frame = 0;
+	stats = (compositor_stats_t){ };
+	for (u32 i = 0; i < MOD_COMPOSITOR_MAX_LAYERS; i++) {
+		layers[i] = (layer_t){ .opacity = 255, .blend = COMPOSITOR_BLEND_NORMAL };
+	}
+	memset(layer_buffers, 0, sizeof layer_buffers);
+}
+
+void compositor_start(u32 fps) {
+	if (target == nullptr) utils_error_mode(30); // render only target - nothing for core1 to present
+	const u32 min_us = wsleds_instance_frame_us(target);
+	period_us = fps != 0 ? 1'000'000 / fps : min_us;
+	if (period_us < min_us) {
+		utils_printf("!!! COMPOSITOR FPS %lu TOO HIGH, USING %lu\n", (unsigned long)fps,
+		             (unsigned long)(1'000'000 / min_us));
+		period_us = min_us;
+	}
+	multicore_launch_core1(core1_main);
+}
+
+compositor_stats_t compositor_get_stats() {
+	return stats;
+}
+
+bool compositor_set_layer(const u8 layer, const compositor_render_t render, void *user_data) {
+	return post(&(message_t){ .type = MSG_LAYER, .layer = layer, .render = render, .user_data = user_data });
+}
+
+bool compositor_set_opacity(const u8 layer, const u8 opacity) {
+	return post(&(message_t){ .type = MSG_OPACITY, .layer = layer, .value = opacity });
+}
+
+bool compositor_set_blend(const u8 layer, const compositor_blend_t blend) {
+	return post(&(message_t){ .type = MSG_BLEND, .layer = layer, .value = blend });
+}
+
+bool compositor_set_enabled(const u8 layer, const bool enabled) {
+	return post(&(message_t){ .type = MSG_ENABLED, .layer = layer, .value = enabled });
+}
+
+bool compositor_set_param(const u8 layer, const u32 param) {
+	return post(&(message_t){ .type = MSG_PARAM, .layer = layer, .value = param });
+}
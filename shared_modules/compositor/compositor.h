@@ -0,0 +1,85 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "../wsleds/wsleds.h"
+#include "shared_config.h"
+
+/*
+ * Layered LED compositor - every layer has its own effect callback, buffer, opacity and blend mode. Core1 renders
+ * all layers bottom up, composites them into the wsleds buffer and presents at fixed FPS. Core0 only posts changes
+ * through a lock-free single producer mailbox (applied by core1 between frames), so it never waits on rendering.
+ *
+ *   compositor_init(wsleds_default(), 8, 8);
+ *   compositor_set_layer(0, plasma, nullptr);
+ *   compositor_set_layer(1, clock_digits, &clock);
+ *   compositor_set_blend(1, COMPOSITOR_BLEND_KEYED);
+ *   compositor_start(50);
+ *   ...
+ *   compositor_set_param(1, new_minute); // from core0, any time
+ */
+
+typedef enum {
+	COMPOSITOR_BLEND_NORMAL, // layer over what's below, opacity mixes
+	COMPOSITOR_BLEND_KEYED, // same as normal, but black pixels are see-through (text, sprites)
+	COMPOSITOR_BLEND_ADD, // saturating add, black is see-through
+	COMPOSITOR_BLEND_MULTIPLY, // darkens, white is see-through
+	COMPOSITOR_BLEND_MAX, // brighter channel wins, black is see-through
+} compositor_blend_t;
+
+/**
+ * Renders layer - \c buffer is row major \c width x \c height and keeps its contents between frames (starts black)
+ *
+ * @param frame Frames composed since \c compositor_start
+ * @param param Last value posted with \c compositor_set_param
+ */
+typedef void (*compositor_render_t)(u32 *buffer, u16 width, u16 height, u32 frame, u32 param, void *user_data);
+
+typedef struct {
+	u32 frames;
+	u32 overruns; // frames that took longer than the frame period
+	u32 busy_us; // render + composite + present of the last frame
+} compositor_stats_t;
+
+/**
+ * Sets target (\c leds buffer must be \c width * \c height logical pixels) and clears every layer
+ *
+ * @param leds Initialized instance, core1 is the only one presenting it from \c compositor_start on. \c nullptr only
+ * for driving \c compositor_render_frame yourself (\c compositor_start enters error mode)
+ */
+void compositor_init(wsleds_t *leds, u16 width, u16 height);
+
+/**
+ * Launches core1 render loop, \c fps is clamped to what the strip can do
+ */
+void compositor_start(u32 fps);
+
+/**
+ * Applies posted messages, renders and composites every enabled layer into \c out - what core1 does before each
+ * present. For running on a core you already own, or off target.
+ */
+void compositor_render_frame(u32 *out);
+
+compositor_stats_t compositor_get_stats();
+
+// --- core0 -> core1 mailbox, all return false when mailbox is full (retry next loop), only one core may post
+
+/**
+ * Replaces layer effect (enables the layer, buffer is cleared), \c nullptr disables it
+ */
+bool compositor_set_layer(u8 layer, compositor_render_t render, void *user_data);
+
+/**
+ * @param opacity 0 - hidden, 255 - fully on
+ */
+bool compositor_set_opacity(u8 layer, u8 opacity);
+
+bool compositor_set_blend(u8 layer, compositor_blend_t blend);
+
+bool compositor_set_enabled(u8 layer, bool enabled);
+
+/**
+ * Effect specific value (color, speed, digit, ...) passed to layer render callback
+ */
+bool compositor_set_param(u8 layer, u32 param);
@@ -0,0 +1,18 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "../wsleds/shared_config.h"
+
+#ifndef MOD_COMPOSITOR_MAX_LAYERS
+#define MOD_COMPOSITOR_MAX_LAYERS       4
+#endif
+
+#ifndef MOD_COMPOSITOR_MAX_LEDS
+#define MOD_COMPOSITOR_MAX_LEDS         MOD_WSLEDS_LED_COUNT // per layer buffer, 4 bytes per LED per layer
+#endif
+
+#ifndef MOD_COMPOSITOR_MAILBOX_SIZE
+#define MOD_COMPOSITOR_MAILBOX_SIZE     16 // power of two, messages core0 can queue between two frames
+#endif
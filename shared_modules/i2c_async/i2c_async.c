@@ -0,0 +1,179 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "i2c_async.h"
+
+#include <hardware/irq.h>
+#include <hardware/sync.h>
+#include <pico/time.h>
+
+#include "utils.h"
+
+static_assert((MOD_I2C_ASYNC_QUEUE_SIZE & (MOD_I2C_ASYNC_QUEUE_SIZE - 1)) == 0);
+
+#define C_FIFO_DEPTH 16
+
+static i2c_inst_t *port = nullptr;
+static u32 rate = 0;
+
+// ring of waiting transactions, touched with interrupts off (submitters are threads and IRQs of one core)
+static i2c_async_transaction_t *queue[MOD_I2C_ASYNC_QUEUE_SIZE] = { };
+static u32 queue_head = 0;
+static u32 queue_tail = 0;
+
+// transaction on the bus - state below is IRQ only while it's set
+static i2c_async_transaction_t *current = nullptr;
+static u8 cmd_index = 0; // next data_cmd to push, writes first, then read commands
+static u8 rx_index = 0;
+static bool aborted = false;
+
+static volatile i2c_async_stats_t stats = { };
+
+static void start(i2c_async_transaction_t *transaction) {
+	i2c_hw_t *hw = i2c_get_hw(port);
+	hw->enable = 0;
+	hw->tar = transaction->address;
+	hw->enable = 1;
+
+	cmd_index = 0;
+	rx_index = 0;
+	aborted = false;
+	transaction->status = I2C_ASYNC_BUSY;
+	if (transaction->attempts++ == 0) transaction->start_us = time_us_32();
+	// TX_EMPTY fires right away and fills the FIFO
+	hw->intr_mask = I2C_IC_INTR_MASK_M_TX_EMPTY_BITS | I2C_IC_INTR_MASK_M_RX_FULL_BITS
+	                | I2C_IC_INTR_MASK_M_TX_ABRT_BITS | I2C_IC_INTR_MASK_M_STOP_DET_BITS;
+}
+
+static void start_next() {
+	if (current != nullptr || queue_head == queue_tail) return;
+	current = queue[queue_tail++ & (MOD_I2C_ASYNC_QUEUE_SIZE - 1)];
+	start(current);
+}
+
+static i64 retry_alarm(alarm_id_t, void *) {
+	start(current);
+	return 0;
+}
+
+static void finish() {
+	i2c_async_transaction_t *transaction = current;
+	i2c_get_hw(port)->intr_mask = 0;
+
+	if (aborted || rx_index != transaction->read_len) {
+		if (transaction->attempts <= transaction->retries) {
+			stats.retries++;
+			if (add_alarm_in_us(MOD_I2C_ASYNC_RETRY_US, retry_alarm, nullptr, true) < 0) start(transaction);
+			return;
+		}
+		transaction->status = I2C_ASYNC_FAILED;
+		stats.failed++;
+	} else {
+		transaction->status = I2C_ASYNC_DONE;
+		stats.done++;
+	}
+
+	transaction->end_us = time_us_32();
+	const u32 bus_us = transaction->end_us - transaction->start_us;
+	const u32 wait_us = transaction->start_us - transaction->queued_us;
+	stats.last_us = bus_us;
+	if (bus_us > stats.max_us) stats.max_us = bus_us;
+	if (wait_us > stats.max_wait_us) stats.max_wait_us = wait_us;
+
+	current = nullptr;
+	if (transaction->callback != nullptr) transaction->callback(transaction);
+	start_next();
+}
+
+static void feed(i2c_hw_t *hw) {
+	const u8 total = current->write_len + current->read_len;
+	while (cmd_index < total && hw->txflr < C_FIFO_DEPTH) {
+		u32 cmd;
+		if (cmd_index < current->write_len) {
+			cmd = current->write[cmd_index];
+		} else {
+			if (cmd_index - current->write_len - rx_index >= C_FIFO_DEPTH) break; // RX FIFO would overflow
+			cmd = I2C_IC_DATA_CMD_CMD_BITS;
+			if (cmd_index == current->write_len && current->write_len != 0) cmd |= I2C_IC_DATA_CMD_RESTART_BITS;
+		}
+		if (cmd_index == total - 1) cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+		hw->data_cmd = cmd;
+		cmd_index++;
+	}
+	if (cmd_index == total) hw->intr_mask &= ~I2C_IC_INTR_MASK_M_TX_EMPTY_BITS;
+}
+
+static void i2c_irq_handler() {
+	i2c_hw_t *hw = i2c_get_hw(port);
+	const u32 status = hw->intr_stat;
+	if (unlikely(current == nullptr)) {
+		hw->intr_mask = 0;
+		return;
+	}
+
+	if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+		current->abort_source = hw->tx_abrt_source;
+		(void)hw->clr_tx_abrt; // also flushes TX FIFO, controller sends STOP
+		aborted = true;
+		hw->intr_mask &= ~I2C_IC_INTR_MASK_M_TX_EMPTY_BITS;
+	}
+	while (hw->rxflr > 0) {
+		const u8 byte = (u8)hw->data_cmd;
+		if (rx_index < current->read_len) current->read[rx_index++] = byte;
+	}
+	if (!aborted && status & I2C_IC_INTR_STAT_R_TX_EMPTY_BITS) feed(hw);
+	if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+		(void)hw->clr_stop_det;
+		finish();
+	}
+}
+
+u32 i2c_async_init(i2c_inst_t *i2c, const u32 baudrate) {
+	if (port == i2c) return rate;
+	if (port != nullptr) utils_error_mode(31); // mode(31)
+
+	rate = i2c_init(i2c, baudrate);
+	port = i2c;
+	i2c_hw_t *hw = i2c_get_hw(i2c);
+	hw->intr_mask = 0;
+	hw->rx_tl = 0; // every byte
+	hw->tx_tl = MOD_I2C_ASYNC_TX_THRESHOLD;
+
+	const auto irq = I2C0_IRQ + i2c_get_index(i2c);
+	irq_set_exclusive_handler(irq, i2c_irq_handler);
+	irq_set_enabled(irq, true);
+	return rate;
+}
+
+bool i2c_async_submit(i2c_async_transaction_t *transaction) {
+	if (port == nullptr || transaction->write_len + transaction->read_len == 0) return false;
+
+	const auto irq_state = save_and_disable_interrupts();
+	const bool accepted = queue_head - queue_tail != MOD_I2C_ASYNC_QUEUE_SIZE && !i2c_async_is_busy(transaction);
+	if (accepted) {
+		transaction->status = I2C_ASYNC_QUEUED;
+		transaction->attempts = 0;
+		transaction->abort_source = 0;
+		transaction->queued_us = time_us_32();
+		queue[queue_head++ & (MOD_I2C_ASYNC_QUEUE_SIZE - 1)] = transaction;
+		start_next();
+	}
+	restore_interrupts(irq_state);
+	return accepted;
+}
+
+bool i2c_async_wait(const i2c_async_transaction_t *transaction) {
+	while (i2c_async_is_busy(transaction)) tight_loop_contents();
+	return transaction->status == I2C_ASYNC_DONE;
+}
+
+bool i2c_async_transfer(i2c_async_transaction_t *transaction) {
+	if (port == nullptr || transaction->write_len + transaction->read_len == 0) return false;
+	i2c_async_wait(transaction); // still going from an earlier submit
+	while (!i2c_async_submit(transaction)) tight_loop_contents();
+	return i2c_async_wait(transaction);
+}
+
+i2c_async_stats_t i2c_async_get_stats() {
+	return stats;
+}
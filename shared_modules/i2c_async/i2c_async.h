@@ -0,0 +1,97 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <hardware/i2c.h>
+
+#include "shared_config.h"
+
+/*
+ * Interrupt driven I2C transaction queue - callers submit write or write + repeated start + read transactions and
+ * carry on, the I2C IRQ feeds and drains the FIFO, aborted transfers are retried from an alarm and completion
+ * callbacks run from IRQ. Every driver on the bus has to go through it (no *_blocking calls next to it).
+ * Transaction is owned by the caller and must stay untouched while queued or busy - its status is the future.
+ * Submit from the core that called \c i2c_async_init (threads or IRQs).
+ *
+ *   static u8 regist = 0x12, gpio[2];
+ *   static i2c_async_transaction_t read = { .address = 0x20, .write = &regist, .write_len = 1, .read = gpio,
+ *                                           .read_len = 2, .retries = 2 };
+ *   i2c_async_submit(&read);
+ *   ...
+ *   if (read.status == I2C_ASYNC_DONE) use(gpio);
+ */
+
+typedef enum {
+	I2C_ASYNC_IDLE, // never submitted
+	I2C_ASYNC_QUEUED,
+	I2C_ASYNC_BUSY, // on the bus or waiting for retry
+	I2C_ASYNC_DONE,
+	I2C_ASYNC_FAILED, // aborted (NACK, arbitration) more than \c retries times
+} i2c_async_status_t;
+
+typedef struct i2c_async_transaction i2c_async_transaction_t;
+
+/**
+ * Runs from IRQ once transaction is done or failed, may submit again (same transaction too)
+ */
+typedef void (*i2c_async_callback_t)(i2c_async_transaction_t *transaction);
+
+struct i2c_async_transaction {
+	u8 address;
+	const u8 *write; // written first, may be nullptr with 0 length
+	u8 write_len;
+	u8 *read; // read after repeated start, may be nullptr with 0 length
+	u8 read_len;
+	u8 retries;
+	i2c_async_callback_t callback; // may be nullptr
+	void *user_data;
+
+	// set by the engine
+	volatile i2c_async_status_t status;
+	u8 attempts;
+	u32 abort_source; // IC_TX_ABRT_SOURCE of the last failed attempt
+	u32 queued_us;
+	u32 start_us; // first attempt put on the bus
+	u32 end_us;
+};
+
+typedef struct {
+	u32 done;
+	u32 failed;
+	u32 retries;
+	u32 last_us; // bus time of the last transaction, retries included
+	u32 max_us;
+	u32 max_wait_us; // longest time a transaction sat in the queue
+} i2c_async_stats_t;
+
+/**
+ * Inits \c i2c (pins are up to the caller) and takes over its IRQ. Calling again with the same port only returns
+ * the rate, the engine drives one bus.
+ *
+ * @return Actual baudrate
+ */
+u32 i2c_async_init(i2c_inst_t *i2c, u32 baudrate);
+
+/**
+ * @return false when queue is full, transaction is still queued/busy or has nothing to transfer
+ */
+bool i2c_async_submit(i2c_async_transaction_t *transaction);
+
+static inline bool i2c_async_is_busy(const i2c_async_transaction_t *transaction) {
+	return transaction->status == I2C_ASYNC_QUEUED || transaction->status == I2C_ASYNC_BUSY;
+}
+
+/**
+ * Spins until transaction is done - not from a callback or an IRQ
+ *
+ * @return true if it went through
+ */
+bool i2c_async_wait(const i2c_async_transaction_t *transaction);
+
+/**
+ * Submit (waiting for a free queue slot) + wait, for setup code
+ */
+bool i2c_async_transfer(i2c_async_transaction_t *transaction);
+
+i2c_async_stats_t i2c_async_get_stats();
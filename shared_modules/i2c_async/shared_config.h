@@ -0,0 +1,18 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "../../shared_config.h"
+
+#ifndef MOD_I2C_ASYNC_QUEUE_SIZE
+#define MOD_I2C_ASYNC_QUEUE_SIZE    16 // power of two, transactions waiting behind the one on the bus
+#endif
+
+#ifndef MOD_I2C_ASYNC_RETRY_US
+#define MOD_I2C_ASYNC_RETRY_US      500 // bus rest before aborted transaction is retried (alarm, nothing sleeps)
+#endif
+
+#ifndef MOD_I2C_ASYNC_TX_THRESHOLD
+#define MOD_I2C_ASYNC_TX_THRESHOLD  4 // FIFO is refilled from IRQ when this many commands are left
+#endif
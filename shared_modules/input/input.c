@@ -0,0 +1,160 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "input.h"
+
+#include <hardware/gpio.h>
+#include <pico/time.h>
+#include <stdatomic.h>
+
+#include "utils.h"
+
+static_assert((MOD_INPUT_QUEUE_SIZE & (MOD_INPUT_QUEUE_SIZE - 1)) == 0);
+static_assert(MOD_INPUT_MAX_INPUTS <= 255);
+
+#define C_LONG_PRESS_SCANS	((MOD_INPUT_LONG_PRESS_MS + MOD_INPUT_SCAN_MS - 1) / MOD_INPUT_SCAN_MS)
+
+typedef enum {
+	SOURCE_GPIO, SOURCE_MCP
+} source_t;
+
+// one word of pins, every bit plane below is per pin
+typedef struct {
+	source_t source;
+	u8 device;
+	u32 used;
+	u32 state; // debounced, 1 - pressed
+	u32 count0; // vertical 2 bit counter of samples that differ from state
+	u32 count1;
+	u32 long_sent;
+	u8 ids[32];
+} port_t;
+
+typedef struct {
+	u8 port;
+	u8 bit;
+	u16 held_scans;
+} entry_t;
+
+static port_t ports[MOD_INPUT_MAX_PORTS] = { };
+static u8 port_count = 0;
+static entry_t entries[MOD_INPUT_MAX_INPUTS] = { };
+static u8 entry_count = 0;
+static repeating_timer_t scan_timer;
+
+// SPSC ring - head written by scan only, tail by input_poll only
+static input_event_t queue[MOD_INPUT_QUEUE_SIZE] = { };
+static atomic_uint queue_head = 0;
+static atomic_uint queue_tail = 0;
+static volatile u32 dropped = 0;
+
+static void push(const u8 id, const input_event_type_t type, const u32 time_ms) {
+	const u32 head = atomic_load_explicit(&queue_head, memory_order_relaxed);
+	const u32 tail = atomic_load_explicit(&queue_tail, memory_order_acquire);
+	if (head - tail == MOD_INPUT_QUEUE_SIZE) {
+		dropped++;
+		return;
+	}
+	queue[head & (MOD_INPUT_QUEUE_SIZE - 1)] = (input_event_t){ .id = id, .type = type, .time_ms = time_ms };
+	atomic_store_explicit(&queue_head, head + 1, memory_order_release); // publishes the slot
+}
+
+static u8 add(const source_t source, const u8 device, const u8 bit) {
+	u8 port = 0;
+	while (port < port_count && (ports[port].source != source || ports[port].device != device)) port++;
+	if (port == port_count) {
+		if (port_count == MOD_INPUT_MAX_PORTS) utils_error_mode(32); // mode(32)
+		ports[port_count++] = (port_t){ .source = source, .device = device };
+	}
+	if (entry_count == MOD_INPUT_MAX_INPUTS) utils_error_mode(32); // mode(32)
+
+	const u8 id = entry_count++;
+	entries[id] = (entry_t){ .port = port, .bit = bit };
+	ports[port].ids[bit] = id;
+	ports[port].used |= 1u << bit;
+	return id;
+}
+
+u8 input_add_gpio(const u8 pin) {
+	if (pin >= 32) utils_error_mode(32); // mode(32)
+	gpio_init(pin);
+	gpio_set_dir(pin, GPIO_IN);
+	gpio_pull_up(pin);
+	return add(SOURCE_GPIO, 0, pin);
+}
+
+u8 input_add_mcp(const mcp_pin_t pin) {
+	mcp_cfg_set_pin_out_mode(pin, false);
+	mcp_cfg_set_pull_up(pin, true);
+	return add(SOURCE_MCP, mcp_pin_device(pin), mcp_pin_index(pin));
+}
+
+static inline u32 sample(const port_t *port) {
+	const u32 levels = port->source == SOURCE_GPIO ? gpio_get_all() : mcp_get_inputs(port->device);
+	return ~levels & port->used; // active low
+}
+
+void input_scan() {
+	const u32 now_ms = (u32)(time_us_64() / 1000);
+	for (u8 i = 0; i < port_count; i++) {
+		port_t *port = &ports[i];
+
+		// every pin at once - counter runs while sample differs from state, resets when it doesn't, 4th differing
+		// sample in a row flips the state
+		const u32 delta = sample(port) ^ port->state;
+		port->count1 = (port->count1 ^ port->count0) & delta;
+		port->count0 = ~port->count0 & delta;
+		const u32 toggled = delta & ~(port->count0 | port->count1);
+		port->state ^= toggled;
+
+		for (u32 bits = toggled; bits != 0; bits &= bits - 1) {
+			const u8 bit = (u8)__builtin_ctz(bits);
+			const u8 id = port->ids[bit];
+			if (port->state & 1u << bit) {
+				entries[id].held_scans = 0;
+				push(id, INPUT_PRESS, now_ms);
+			} else {
+				port->long_sent &= ~(1u << bit);
+				push(id, INPUT_RELEASE, now_ms);
+			}
+		}
+
+		// only pins being held cost anything here
+		for (u32 bits = port->state & ~port->long_sent; bits != 0; bits &= bits - 1) {
+			const u8 bit = (u8)__builtin_ctz(bits);
+			const u8 id = port->ids[bit];
+			if (++entries[id].held_scans < C_LONG_PRESS_SCANS) continue;
+			port->long_sent |= 1u << bit;
+			push(id, INPUT_LONG_PRESS, now_ms);
+		}
+	}
+}
+
+static bool scan_timer_callback(repeating_timer_t *) {
+	input_scan();
+	return true;
+}
+
+void input_start() {
+	add_repeating_timer_ms(-MOD_INPUT_SCAN_MS, scan_timer_callback, nullptr, &scan_timer);
+}
+
+bool input_poll(input_event_t *event) {
+	const u32 head = atomic_load_explicit(&queue_head, memory_order_acquire);
+	const u32 tail = atomic_load_explicit(&queue_tail, memory_order_relaxed);
+	if (head == tail) return false;
+
+	*event = queue[tail & (MOD_INPUT_QUEUE_SIZE - 1)];
+	atomic_store_explicit(&queue_tail, tail + 1, memory_order_release); // slot free for scan again
+	return true;
+}
+
+bool input_is_pressed(const u8 id) {
+	if (id >= entry_count) return false;
+	const entry_t *entry = &entries[id];
+	return ports[entry->port].state & 1u << entry->bit;
+}
+
+u32 input_get_dropped() {
+	return dropped;
+}
@@ -0,0 +1,74 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "../mcp/mcp.h"
+#include "shared_config.h"
+
+/*
+ * Debounced buttons on native GPIO and MCP23017 pins - a timer samples every port (32 native pins, 16 pins per
+ * expander from its RAM cache) each MOD_INPUT_SCAN_MS and runs a vertical counter over whole port words, so cost
+ * doesn't grow with input count. Edges become press / release / long press events in a lock-free single consumer
+ * queue. Inputs are active low (switch to ground, pull-up on).
+ *
+ *   const u8 fire = input_add_gpio(14);
+ *   const u8 menu = input_add_mcp(MCP_PIN(0, 1, 3));
+ *   input_start();
+ *   ...
+ *   input_event_t event;
+ *   while (input_poll(&event)) if (event.id == menu && event.type == INPUT_LONG_PRESS) ...
+ */
+
+typedef enum {
+	INPUT_PRESS,
+	INPUT_RELEASE,
+	INPUT_LONG_PRESS, // still held MOD_INPUT_LONG_PRESS_MS after press, release follows as usual
+} input_event_type_t;
+
+typedef struct {
+	u8 id;
+	input_event_type_t type;
+	u32 time_ms; // scan that saw it
+} input_event_t;
+
+/**
+ * Native pin 0..31 - sets it up as input with pull-up
+ *
+ * @return Input id
+ */
+u8 input_add_gpio(u8 pin);
+
+/**
+ * Expander pin - sets it up as input with pull-up, \c mcp_init has to run before scanning starts
+ *
+ * @return Input id
+ */
+u8 input_add_mcp(mcp_pin_t pin);
+
+/**
+ * Starts scan timer (IRQs of the calling core)
+ */
+void input_start();
+
+/**
+ * One scan - what the timer does, for driving it from your own loop instead of \c input_start
+ */
+void input_scan();
+
+/**
+ * Single consumer
+ *
+ * @return false when queue is empty
+ */
+bool input_poll(input_event_t *event);
+
+/**
+ * Debounced state
+ */
+bool input_is_pressed(u8 id);
+
+/**
+ * @return Events dropped because queue was full
+ */
+u32 input_get_dropped();
@@ -0,0 +1,26 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "../mcp/shared_config.h"
+
+#ifndef MOD_INPUT_MAX_INPUTS
+#define MOD_INPUT_MAX_INPUTS        64 // ids handed out by input_add_*, up to 255
+#endif
+
+#ifndef MOD_INPUT_MAX_PORTS
+#define MOD_INPUT_MAX_PORTS         9 // native GPIO + one per MCP23017 with inputs
+#endif
+
+#ifndef MOD_INPUT_SCAN_MS
+#define MOD_INPUT_SCAN_MS           5 // 4 equal samples flip debounced state - 20 ms
+#endif
+
+#ifndef MOD_INPUT_LONG_PRESS_MS
+#define MOD_INPUT_LONG_PRESS_MS     800
+#endif
+
+#ifndef MOD_INPUT_QUEUE_SIZE
+#define MOD_INPUT_QUEUE_SIZE        32 // power of two, events waiting for input_poll
+#endif
@@ -4,14 +4,24 @@
 #include "mcp.h"
 
 #include <hardware/gpio.h>
-#include <hardware/i2c.h>
+#include <hardware/irq.h>
+#include <hardware/sync.h>
+#include <pico/time.h>
+#include <string.h>
 
+#include "../i2c_async/i2c_async.h"
 #include "shared_config.h"
 #include "utils.h"
 
 // MCP23017 registers (Bank Mode 1)
 #define C_IODIRA	0x00 // I/O Direction Register A
 #define C_IODIRB	0x01 // I/O Direction Register B
+#define C_IPOLA		0x02 // Input polarity A - 1 reads inverted
+#define C_GPINTENA	0x04 // Interrupt-on-change enable A
+#define C_GPINTENB	0x05 // Interrupt-on-change enable B
+#define C_INTCONA	0x08 // Interrupt compare A - 0 compares against previous pin value
+#define C_INTCONB	0x09 // Interrupt compare B
+#define C_INTCAPA	0x10 // Interrupt captured value A (read clears interrupt)
 #define C_GPIOA		0x12 // GPIO Register A
 #define C_GPIOB		0x13 // GPIO Register B
 #define C_GPPUA		0x0C // PULL UP A
@@ -27,66 +37,102 @@
 #define C_IOCON_ODR_BIT		2
 #define C_IOCON_INTPOL_BIT	1
 
-// cache variables
-static u8 cache_mcp1_gpioa = 0;
-static u8 cache_mcp1_gpiob = 0;
-static u8 cache_mcp2_gpioa = 0;
-static u8 cache_mcp2_gpiob = 0;
-static u32 cache_last_mcp1_gpio = 0;
-static u32 cache_last_mcp2_gpio = 0;
+#define C_OLATA		0x14 // Output Latch A
+#define C_REG_COUNT	0x16 // IODIRA..OLATB, sequential address pointer walks all of them
+
+// error modes, long blinks - what failed, short blinks - device index + 1
+#define C_ERROR_WRITE		50 // mode(51..58)
+#define C_ERROR_READ		60 // mode(61..68)
+#define C_ERROR_INPUTS		70 // mode(71..78)
+
+static const u8 addresses[] = MOD_MCP_ADDRS;
+static const i32 int_pins[] = MOD_MCP_INT_PINS;
+
+#define C_DEVICE_COUNT	(sizeof addresses / sizeof addresses[0])
+static_assert(C_DEVICE_COUNT >= 1 && C_DEVICE_COUNT <= 8);
+static_assert(sizeof int_pins / sizeof int_pins[0] == C_DEVICE_COUNT);
+
+typedef struct {
+	// outputs and config - write-back shadow of what the chip holds (GPIO slots are never written as-is)
+	u8 regs[C_REG_COUNT];
+	u32 dirty; // bit per register, written by next flush
+	u8 configured[C_REG_COUNT]; // bits set by cfg calls, win over what the chip holds when mcp_init seeds the shadow
+	u8 write_buffer[1 + C_REG_COUNT]; // register pointer + burst, owned by write while it's busy
+	i2c_async_transaction_t write;
+
+	// inputs
+	volatile u16 gpio; // GPIOA | GPIOB << 8 as last read
+	volatile bool pending; // read requested while one was on the bus, repeated from its callback
+	u8 read_regist;
+	u8 read_buffer[4]; // INTCAPA, INTCAPB, GPIOA, GPIOB or just GPIOA, GPIOB
+	i2c_async_transaction_t read;
+} device_t;
+
+// power-on defaults until mcp_init reads the chips - all pins inputs
+static device_t devices[C_DEVICE_COUNT] = {
+	[0 ... C_DEVICE_COUNT - 1] = { .regs = { [C_IODIRA] = 0xFF, [C_IODIRB] = 0xFF } },
+};
 
 static bool init = false;
+static volatile i32 failed_code = 0; // set from I2C IRQ, error mode entered from thread side
+static repeating_timer_t sweep_timer;
+
+// blocking, for init only
+static void transfer(const u8 device, const u8 *write, const u8 write_len, u8 *read, const u8 read_len,
+                     const i32 error_code) {
+	i2c_async_transaction_t transaction = {
+		.address = addresses[device], .write = write, .write_len = write_len, .read = read, .read_len = read_len,
+		.retries = MOD_MCP_WRITE_RETRY_COUNT
+	};
+	if (!i2c_async_transfer(&transaction)) utils_error_mode(error_code + device + 1);
+}
 
-// TODO: hardcoded for TWO MCPs, refactor hard
-static void write_register(const u8 address, const u8 regist, const u8 value) {
+static void write_register(const u8 device, const u8 regist, const u8 value) {
 	const u8 data[2] = { regist, value };
-	auto const result = i2c_write_blocking(MOD_MCP_I2C_PORT, address, data, 2, false);
-	if (result < PICO_ERROR_NONE) utils_error_mode(address == MOD_MCP_ADDR1 ? 11 : 12); // mode(11) (mode12)
-}
-
-static u8 read_register(const u8 address, const u8 regist) {
-	u8 value;
-	auto result = i2c_write_blocking(MOD_MCP_I2C_PORT, address, &regist, 1, true);
-	if (result < PICO_ERROR_NONE) utils_error_mode(address == MOD_MCP_ADDR1 ? 13 : 14); // mode(13) (mode14)
-	result = i2c_read_blocking(MOD_MCP_I2C_PORT, address, &value, 1, false);
-	if (result < PICO_ERROR_NONE) utils_error_mode(address == MOD_MCP_ADDR1 ? 15 : 16); // mode(15) mode(16)
-	return value;
-}
-
-static u16 read_dual_registers(const u8 address, const u8 regist) {
-	u8 value[2] = { 0 };
-	auto result = i2c_write_blocking(MOD_MCP_I2C_PORT, address, &regist, 1, true);
-	if (result < PICO_ERROR_NONE) utils_error_mode(address == MOD_MCP_ADDR1 ? 17 : 18); // mode(17) (mode18)
-	for (auto i = -1; i < MOD_MCP_WRITE_RETRY_COUNT; i++) {
-		result = i2c_read_blocking(MOD_MCP_I2C_PORT, address, value, 2, false);
-		if (result >= PICO_ERROR_NONE) break;
-		utils_printf("MCP RETRY: %d - %d\n", i + 1, result);
-		sleep_us(500);
-	}
-	if (result < PICO_ERROR_NONE) utils_error_mode(address == MOD_MCP_ADDR1 ? 19 : 20); // mode(19) (mode20)
-	return (value[1] << 8) | value[0];
+	transfer(device, data, 2, nullptr, 0, C_ERROR_WRITE);
 }
 
-static inline bool is_bit_set(const u8 value, const u8 bit) {
+// one sequential transfer, register pointer auto-increments (IOCON.SEQOP = 0)
+static void read_registers(const u8 device, const u8 first, u8 *values, const u8 count) {
+	transfer(device, &first, 1, values, count, C_ERROR_READ);
+}
+
+static inline void check_failed() {
+	if (unlikely(failed_code != 0)) utils_error_mode(failed_code);
+}
+
+static inline bool has_int(const u8 device) {
+	return int_pins[device] >= 0;
+}
+
+static inline bool is_bit_set(const u32 value, const u8 bit) {
 	return 0b1 & (value >> bit);
 }
 
-static inline u8 cfg_address(const u8 data) {
-	return is_bit_set(data, 7) ? MOD_MCP_ADDR2 : MOD_MCP_ADDR1;
+static inline u8 cfg_device(const mcp_pin_t data) {
+	return mcp_pin_device(data);
 }
 
-static inline u8 cfg_gpio_bank(const u8 data) {
+static inline u8 cfg_gpio_bank(const mcp_pin_t data) {
 	return is_bit_set(data, 6) ? C_GPIOB : C_GPIOA;
 }
 
-static inline u8 cfg_iodir_bank(const u8 data) {
+static inline u8 cfg_iodir_bank(const mcp_pin_t data) {
 	return is_bit_set(data, 6) ? C_IODIRB : C_IODIRA;
 }
 
-static inline u8 cfg_gppu_bank(const u8 data) {
+static inline u8 cfg_gppu_bank(const mcp_pin_t data) {
 	return is_bit_set(data, 6) ? C_GPPUB : C_GPPUA;
 }
 
+static inline u8 cfg_gpinten_bank(const mcp_pin_t data) {
+	return C_GPINTENA + is_bit_set(data, 6);
+}
+
+static inline u8 cfg_olat_bank(const mcp_pin_t data) {
+	return C_OLATA + is_bit_set(data, 6);
+}
+
 static inline void set_bit(u8 *value, const u8 bit, const bool set) {
 	if (set) {
 		*value |= (1 << bit);
@@ -95,91 +141,241 @@ static inline void set_bit(u8 *value, const u8 bit, const bool set) {
 	}
 }
 
-static inline u8 cfg_get_number(const u8 data) {
+static inline u8 cfg_get_number(const mcp_pin_t data) {
 	return data & 0b00111111; // last 6 bits
 }
 
-void mcp_cfg_set_pin_out_mode(const u8 data, const bool is_out) {
-	const auto address = cfg_address(data);
-	const auto bank = cfg_iodir_bank(data);
-	auto options = read_register(address, bank);
-	set_bit(&options, cfg_get_number(data), !is_out);
-	write_register(address, bank, options);
+static void flush_device(const u8 device) {
+	device_t *dev = &devices[device];
+	const auto irq_state = save_and_disable_interrupts(); // write callback flushes too
+	if (dev->dirty != 0 && !i2c_async_is_busy(&dev->write)) {
+		// one burst from first to last dirty register, clean ones in between are rewritten with the same value
+		const u8 first = (u8)__builtin_ctz(dev->dirty);
+		const u8 last = (u8)(31 - __builtin_clz(dev->dirty));
+		dev->write_buffer[0] = first;
+		memcpy(dev->write_buffer + 1, &dev->regs[first], last - first + 1);
+		for (u8 reg = C_GPIOA; reg <= C_GPIOB; reg++) {
+			if (reg >= first && reg <= last) dev->write_buffer[1 + reg - first] = dev->regs[reg + C_OLATA - C_GPIOA];
+		}
+		dev->write.write_len = last - first + 2;
+		if (i2c_async_submit(&dev->write)) dev->dirty = 0; // queue full - stays dirty for next flush
+	}
+	restore_interrupts(irq_state);
+}
+
+static void write_done(i2c_async_transaction_t *transaction) {
+	const auto device = (u8)(uintptr_t)transaction->user_data;
+	if (transaction->status == I2C_ASYNC_FAILED) {
+		failed_code = C_ERROR_WRITE + device + 1;
+		return;
+	}
+	flush_device(device); // changes made while this one was on the bus
+}
+
+void mcp_flush() {
+	if (!init) return;
+	check_failed();
+	for (u8 device = 0; device < C_DEVICE_COUNT; device++) flush_device(device);
+}
+
+static void shadow_write(const u8 device, const u8 regist, const u8 value) {
+	device_t *dev = &devices[device];
+	if (dev->regs[regist] == value) return;
+	dev->regs[regist] = value;
+	dev->dirty |= 1u << regist;
+}
+
+static void shadow_set_bit(const mcp_pin_t data, const u8 regist, const bool set) {
+	device_t *dev = &devices[cfg_device(data)];
+	u8 value = dev->regs[regist];
+	set_bit(&value, cfg_get_number(data), set);
+	set_bit(&dev->configured[regist], cfg_get_number(data), true); // even if it matches the power-on shadow
+	shadow_write(cfg_device(data), regist, value);
+}
+
+// shadow writes are flushed right away with MOD_MCP_AUTO_FLUSH
+static void auto_flush(const mcp_pin_t data) {
+	if (MOD_MCP_AUTO_FLUSH && init) flush_device(cfg_device(data));
+}
+
+void mcp_cfg_set_pin_out_mode(const mcp_pin_t data, const bool is_out) {
+	shadow_set_bit(data, cfg_iodir_bank(data), !is_out);
+	if (has_int(cfg_device(data))) shadow_set_bit(data, cfg_gpinten_bank(data), !is_out); // inputs interrupt on change
+	auto_flush(data);
+}
+
+void mcp_cfg_set_pull_up(mcp_pin_t pinData, bool pull_up) {
+	shadow_set_bit(pinData, cfg_gppu_bank(pinData), pull_up);
+	auto_flush(pinData);
 }
 
-void mcp_cfg_set_pull_up(u8 pinData, bool pull_up) {
-	const auto address = cfg_address(pinData);
-	const auto bank = cfg_gppu_bank(pinData);
-	auto options = read_register(address, bank);
-	set_bit(&options, cfg_get_number(pinData), pull_up);
-	write_register(address, bank, options);
+void mcp_configure(const mcp_pin_config_t *pins, const u32 count) {
+	u32 touched = 0;
+	for (u32 i = 0; i < count; i++) {
+		const mcp_pin_t pin = pins[i].pin;
+		const u8 flags = pins[i].flags;
+		const u8 port_b = is_bit_set(pin, 6);
+		const bool output = flags & MCP_CFG_OUTPUT;
+		shadow_set_bit(pin, C_IODIRA + port_b, !output);
+		shadow_set_bit(pin, C_IPOLA + port_b, flags & MCP_CFG_INVERT);
+		shadow_set_bit(pin, cfg_gppu_bank(pin), flags & MCP_CFG_PULL_UP);
+		if (has_int(cfg_device(pin))) shadow_set_bit(pin, cfg_gpinten_bank(pin), !output);
+		if (output) shadow_set_bit(pin, cfg_olat_bank(pin), flags & MCP_CFG_HIGH);
+		touched |= 1u << cfg_device(pin);
+	}
+	if (!init) return; // mcp_init writes it
+	for (u8 device = 0; device < C_DEVICE_COUNT; device++) {
+		if (is_bit_set(touched, device)) flush_device(device);
+	}
 }
 
-static void setup_bank_configuration(const u8 address, const u8 regist) {
+static void setup_bank_configuration(const u8 device, const u8 regist, const bool interrupts) {
 	u8 iocon_data = 0;
 	set_bit(&iocon_data, C_IOCON_BANK_BIT, false); // set to Bank Mode 0
-	set_bit(&iocon_data, C_IOCON_MIRROR_BIT, false);
+	set_bit(&iocon_data, C_IOCON_MIRROR_BIT, interrupts); // INTA and INTB both fire for either port, one Pico pin
 	set_bit(&iocon_data, C_IOCON_SEQOP_BIT, false);
 	set_bit(&iocon_data, C_IOCON_DISSLW_BIT, false);
 	set_bit(&iocon_data, C_IOCON_HAEN_BIT, false);
-	set_bit(&iocon_data, C_IOCON_ODR_BIT, false);
+	set_bit(&iocon_data, C_IOCON_ODR_BIT, interrupts); // open drain, so expanders may share one pulled up pin
 	set_bit(&iocon_data, C_IOCON_INTPOL_BIT, false);
-	write_register(address, regist, iocon_data);
+	write_register(device, regist, iocon_data);
+}
+
+// queues INTCAP/GPIO burst (also clears the interrupt and re-arms INT pin), once more if one is on the bus already
+static void request_inputs(const u8 device) {
+	device_t *dev = &devices[device];
+	const auto irq_state = save_and_disable_interrupts();
+	dev->pending = i2c_async_is_busy(&dev->read) || !i2c_async_submit(&dev->read);
+	restore_interrupts(irq_state);
+}
+
+static void read_done(i2c_async_transaction_t *transaction) {
+	const auto device = (u8)(uintptr_t)transaction->user_data;
+	device_t *dev = &devices[device];
+	if (transaction->status == I2C_ASYNC_FAILED) {
+		failed_code = C_ERROR_INPUTS + device + 1;
+		return;
+	}
+	const u8 *gpio = &dev->read_buffer[transaction->read_len - 2];
+	dev->gpio = (u16)(gpio[1] << 8 | gpio[0]);
+	if (dev->pending) request_inputs(device);
+}
+
+// every device that needs a read is queued back to back in one pass
+static bool sweep(repeating_timer_t *) {
+	for (u8 device = 0; device < C_DEVICE_COUNT; device++) {
+		const device_t *dev = &devices[device];
+		if (i2c_async_is_busy(&dev->read)) continue;
+		bool stale;
+		if (has_int(device)) {
+			// INT still low - edge came before IRQ was enabled or full queue turned the read away
+			stale = dev->pending || !gpio_get((u32)int_pins[device]);
+		} else {
+			stale = true; // timer runs every MOD_MCP_GPIO_CACHE_MS
+		}
+		if (stale) request_inputs(device);
+	}
+	return true;
+}
+
+static void int_irq_handler() {
+	u32 fired = 0; // shared lines - collect every device before acknowledging
+	for (u8 device = 0; device < C_DEVICE_COUNT; device++) {
+		if (has_int(device) && gpio_get_irq_event_mask((u32)int_pins[device]) & GPIO_IRQ_EDGE_FALL) {
+			fired |= 1u << device;
+		}
+	}
+	for (u8 device = 0; device < C_DEVICE_COUNT; device++) {
+		if (!is_bit_set(fired, device)) continue;
+		gpio_acknowledge_irq((u32)int_pins[device], GPIO_IRQ_EDGE_FALL);
+		request_inputs(device);
+	}
+}
+
+static void setup_int_pin(const u8 device) {
+	const auto pin = (u32)int_pins[device];
+	gpio_init(pin);
+	gpio_set_dir(pin, GPIO_IN);
+	gpio_pull_up(pin); // INT is open drain
+	for (u8 other = 0; other < device; other++) {
+		if (int_pins[other] == int_pins[device]) return; // shared line, handler already there
+	}
+	gpio_add_raw_irq_handler(pin, int_irq_handler);
+	gpio_set_irq_enabled(pin, GPIO_IRQ_EDGE_FALL, true);
+	irq_set_enabled(IO_IRQ_BANK0, true);
 }
 
 void mcp_init() {
-	init = true;
-	const auto rate = i2c_init(MOD_MCP_I2C_PORT, 400'000); // 400 khz
+	const auto rate = i2c_async_init(MOD_MCP_I2C_PORT, 400'000); // 400 khz
 	if (rate != 400'000) utils_error_mode(10);
 	gpio_set_function(MOD_MCP_PIN_SDA, GPIO_FUNC_I2C);
 	gpio_set_function(MOD_MCP_PIN_SCL, GPIO_FUNC_I2C);
 	gpio_pull_up(MOD_MCP_PIN_SDA);
 	gpio_pull_up(MOD_MCP_PIN_SCL);
-	sleep_ms(1);
 
-	setup_bank_configuration(MOD_MCP_ADDR1, C_IOCONA);
-	setup_bank_configuration(MOD_MCP_ADDR1, C_IOCONB);
-	setup_bank_configuration(MOD_MCP_ADDR2, C_IOCONA);
-	setup_bank_configuration(MOD_MCP_ADDR2, C_IOCONB);
-	sleep_ms(1);
+	// IOCON is one register in Bank Mode 0 (IOCONB is an alias), set before bursts rely on SEQOP
+	for (u8 device = 0; device < C_DEVICE_COUNT; device++) {
+		setup_bank_configuration(device, C_IOCONA, has_int(device));
+	}
+
+	// seed shadows with what chips hold (they may have kept state over a Pico reset), keep bits configured before
+	// init - dirty is whatever that leaves different from the chip
+	for (u8 device = 0; device < C_DEVICE_COUNT; device++) {
+		device_t *dev = &devices[device];
+		u8 regs[C_REG_COUNT];
+		read_registers(device, C_IODIRA, regs, C_REG_COUNT);
+		dev->dirty = 0;
+		for (u8 reg = 0; reg < C_REG_COUNT; reg++) {
+			const u8 mask = dev->configured[reg];
+			dev->regs[reg] = (regs[reg] & ~mask) | (dev->regs[reg] & mask);
+			if (dev->regs[reg] != regs[reg]) dev->dirty |= 1u << reg;
+		}
+		if (has_int(device)) {
+			shadow_write(device, C_GPINTENA, dev->regs[C_IODIRA]); // every input pin, change from previous value
+			shadow_write(device, C_GPINTENB, dev->regs[C_IODIRB]);
+			shadow_write(device, C_INTCONA, 0);
+			shadow_write(device, C_INTCONB, 0);
+		}
+		dev->write = (i2c_async_transaction_t){
+			.address = addresses[device], .write = dev->write_buffer, .retries = MOD_MCP_WRITE_RETRY_COUNT,
+			.callback = write_done, .user_data = (void *)(uintptr_t)device
+		};
+		flush_device(device);
+
+		dev->read_regist = has_int(device) ? C_INTCAPA : C_GPIOA;
+		dev->read = (i2c_async_transaction_t){
+			.address = addresses[device], .write = &dev->read_regist, .write_len = 1, .read = dev->read_buffer,
+			.read_len = has_int(device) ? 4 : 2, .retries = MOD_MCP_WRITE_RETRY_COUNT, .callback = read_done,
+			.user_data = (void *)(uintptr_t)device
+		};
+		if (has_int(device)) setup_int_pin(device);
+	}
+
+	// first read by hand, so inputs are valid when init returns
+	for (u8 device = 0; device < C_DEVICE_COUNT; device++) request_inputs(device);
+	for (u8 device = 0; device < C_DEVICE_COUNT; device++) i2c_async_wait(&devices[device].read);
+	check_failed();
+	add_repeating_timer_ms(-MOD_MCP_GPIO_CACHE_MS, sweep, nullptr, &sweep_timer);
+	init = true;
 }
 
-// TODO: cache like is_pin_low and then don't forget to flush? // takes 0.2-0.3 ms per call at 12mhz....
-void mcp_set_out(const u8 pinData, const bool out) {
+void mcp_set_out(const mcp_pin_t pinData, const bool out) {
 	if (!init) return;
-	const auto address = cfg_address(pinData);
-	const auto bank = cfg_gpio_bank(pinData);
-	auto data = read_register(address, bank);
-	set_bit(&data, cfg_get_number(pinData), out);
-	write_register(address, bank, data);
+	check_failed();
+	shadow_set_bit(pinData, cfg_olat_bank(pinData), out);
+	auto_flush(pinData);
 }
 
-bool mcp_is_pin_low(const u8 pinData) {
+bool mcp_is_pin_low(const mcp_pin_t pinData) {
 	if (!init) return false;
-	const auto address = cfg_address(pinData);
-	const auto bank = cfg_gpio_bank(pinData);
-	u8 data;
-	const bool first_mcp = address == MOD_MCP_ADDR1;
-	u32 *cache_time = first_mcp ? &cache_last_mcp1_gpio : &cache_last_mcp2_gpio;
-	const bool cache_possible = utils_time_diff_ms(*cache_time, time_us_32()) < MOD_MCP_GPIO_CACHE_MS;
-	const bool first_bank = bank == C_GPIOA;
-
-	if (first_mcp && cache_possible) {
-		data = (first_bank ? cache_mcp1_gpioa : cache_mcp1_gpiob);
-	} else if (!first_mcp && cache_possible) {
-		data = (first_bank ? cache_mcp2_gpioa : cache_mcp2_gpiob);
-	} else {
-		const auto new_data = read_dual_registers(address, C_GPIOA); // read both A and B registers
-		const u8 bank_a = new_data & 0b11111111;
-		const u8 bank_b = (new_data >> 8) & 0b11111111;
-		u8 *cache_a = first_mcp ? &cache_mcp1_gpioa : &cache_mcp2_gpioa;
-		u8 *cache_b = first_mcp ? &cache_mcp1_gpiob : &cache_mcp2_gpiob;
-
-		*cache_a = bank_a;
-		*cache_b = bank_b;
-		*cache_time = time_us_32();
-
-		data = first_bank ? bank_a : bank_b;
-	}
+	check_failed();
+	const u16 gpio = devices[cfg_device(pinData)].gpio;
+	const u8 data = cfg_gpio_bank(pinData) == C_GPIOA ? gpio & 0xFF : gpio >> 8;
 	return !is_bit_set(data, cfg_get_number(pinData));
 }
+
+u16 mcp_get_inputs(const u8 device) {
+	if (!init || device >= C_DEVICE_COUNT) return 0xFFFF;
+	check_failed();
+	return devices[device].gpio;
+}
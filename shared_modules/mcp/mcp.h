@@ -5,12 +5,76 @@
 
 #include "shared_config.h"
 
+/**
+ * Expander pin - bits 7..9 device (index in MOD_MCP_ADDRS), bit 6 port B, bits 0..2 pin. Old hand written u8 values
+ * (bit 7 - second expander) keep their meaning.
+ */
+typedef u16 mcp_pin_t;
+
+#define MCP_PIN(device, port_b, pin)    ((mcp_pin_t)((device) << 7 | (port_b) << 6 | (pin)))
+
+static inline u8 mcp_pin_device(const mcp_pin_t pin) {
+	return (pin >> 7) & 0b111;
+}
+
+/**
+ * @return 0..15 - bit in \c mcp_get_inputs word
+ */
+static inline u8 mcp_pin_index(const mcp_pin_t pin) {
+	return ((pin >> 6) & 0b1) * 8 + (pin & 0b111);
+}
+
 void mcp_init();
 
-void mcp_cfg_set_pin_out_mode(const u8 data, const bool is_out);
+void mcp_cfg_set_pin_out_mode(const mcp_pin_t data, const bool is_out);
+
+void mcp_cfg_set_pull_up(mcp_pin_t pinData, bool pull_up);
+
+#define MCP_CFG_INPUT       0
+#define MCP_CFG_OUTPUT      (1 << 0)
+#define MCP_CFG_PULL_UP     (1 << 1)
+#define MCP_CFG_INVERT      (1 << 2) // IPOL - GPIO reads inverted, \c mcp_is_pin_low then means "reads low"
+#define MCP_CFG_HIGH        (1 << 3) // outputs - initial latch level
+
+typedef struct {
+	mcp_pin_t pin;
+	u8 flags; // MCP_CFG_*
+} mcp_pin_config_t;
+
+/**
+ * Applies whole table to shadow registers (IODIR, IPOL, GPPU, GPINTEN, OLAT) and writes each touched expander in
+ * one sequential burst. Before \c mcp_init nothing is written - init seeds the chips with it, so the table costs no
+ * extra transactions at boot.
+ *
+ *   static const mcp_pin_config_t pins[] = {
+ *       { MCP_PIN(0, 0, 0), MCP_CFG_OUTPUT },
+ *       { MCP_PIN(0, 1, 3), MCP_CFG_INPUT | MCP_CFG_PULL_UP },
+ *   };
+ *   mcp_configure(pins, count_of(pins));
+ *   mcp_init();
+ */
+void mcp_configure(const mcp_pin_config_t *pins, u32 count);
+
+/**
+ * Sets output latch in shadow register - written right away with MOD_MCP_AUTO_FLUSH, otherwise by \c mcp_flush
+ */
+void mcp_set_out(const mcp_pin_t pinData, const bool out);
 
-void mcp_cfg_set_pull_up(u8 pinData, bool pull_up);
+/**
+ * Queues every changed shadow register (OLAT, IODIR, GPPU) - one sequential I2C burst per changed expander, doesn't
+ * wait for the bus. Changes made while a burst is on the bus go out right after it.
+ */
+void mcp_flush();
 
-void mcp_set_out(const u8 pinData, const bool out);
+/**
+ * Always a RAM read. Inputs are refreshed by a sweep every MOD_MCP_GPIO_CACHE_MS that queues reads of all expanders
+ * back to back - ones with INT pin wired are read (INTCAP + GPIO burst) only after it fired, right from its IRQ.
+ */
+bool mcp_is_pin_low(const mcp_pin_t pinData);
 
-bool mcp_is_pin_low(const u8 pinData);
+/**
+ * Same RAM cache as \c mcp_is_pin_low, whole expander at once
+ *
+ * @return GPIOA | GPIOB << 8, bit set - pin high
+ */
+u16 mcp_get_inputs(u8 device);
@@ -28,9 +28,29 @@
 #endif
 
 #ifndef MOD_MCP_GPIO_CACHE_MS
-#define MOD_MCP_GPIO_CACHE_MS       6
+#define MOD_MCP_GPIO_CACHE_MS       6 // input sweep period, expanders without INT pin are read every sweep
 #endif
 
 #ifndef MOD_MCP_WRITE_RETRY_COUNT
-#define MOD_MCP_WRITE_RETRY_COUNT   2
+#define MOD_MCP_WRITE_RETRY_COUNT   2 // per transaction, retried by i2c_async without blocking
+#endif
+
+#ifndef MOD_MCP_AUTO_FLUSH
+#define MOD_MCP_AUTO_FLUSH          1 // 0 - pin setters only touch shadow registers, call mcp_flush() once per update
+#endif
+
+#ifndef MOD_MCP_PIN_INT1
+#define MOD_MCP_PIN_INT1            -1 // INTA or INTB of MOD_MCP_ADDR1 (mirrored), -1 - not wired, GPIO polled
+#endif
+
+#ifndef MOD_MCP_PIN_INT2
+#define MOD_MCP_PIN_INT2            -1 // INT of MOD_MCP_ADDR2, may be the same pin as MOD_MCP_PIN_INT1 (open drain)
+#endif
+
+#ifndef MOD_MCP_ADDRS
+#define MOD_MCP_ADDRS               { MOD_MCP_ADDR1, MOD_MCP_ADDR2 } // up to 8, index is the device in MCP_PIN
+#endif
+
+#ifndef MOD_MCP_INT_PINS
+#define MOD_MCP_INT_PINS            { MOD_MCP_PIN_INT1, MOD_MCP_PIN_INT2 } // one per MOD_MCP_ADDRS entry
 #endif
@@ -5,14 +5,18 @@
 
 #include <hardware/adc.h>
 
+#include "fixed.h"
 #include "shared_config.h"
 #include "utils.h"
 
 #define SAMPLE_COUNT 25
 #define ADC_FACTOR (MOD_VMON_VREF / (1 << 12))
+// input millivolts per ADC LSB, folded at compile time
+#define ADC_MV_PER_LSB_Q16 Q16_FROM_FLOAT(ADC_FACTOR * 1000.0f * (MOD_VMON_RES_POS + MOD_VMON_RES_NEG) / MOD_VMON_RES_NEG)
 
 static i32 sample_count = 0;
 static u32 samples[SAMPLE_COUNT] = { };
+static u32 samples_sum = 0;
 
 void v_monitor_init() {
 	adc_init();
@@ -24,7 +28,9 @@ void v_monitor_sample(const bool select_input) {
 	static i32 idx = 0;
 
 	if (select_input) adc_select_input(MOD_VMON_ADC);
-	samples[idx] = adc_read();
+	const u32 sample = adc_read();
+	samples_sum = samples_sum - samples[idx] + sample;
+	samples[idx] = sample;
 
 	idx = (idx + 1) % SAMPLE_COUNT;
 	if (unlikely(sample_count < SAMPLE_COUNT)) sample_count++;
@@ -41,3 +47,13 @@ float v_monitor_voltage(const bool print_result) {
 
 	return v_in;
 }
+
+u32 v_monitor_voltage_mv(const bool print_result) {
+	if (unlikely(sample_count == 0)) return (u32)(MOD_VMON_DEFAULT_REF * 1000.0f);
+
+	const u32 v_in_mv = (u32)(((u64)samples_sum * ADC_MV_PER_LSB_Q16) >> 16) / (u32)sample_count;
+
+	if (print_result) utils_printf("bat: %lu mV (samples: %d)\n", v_in_mv, sample_count);
+
+	return v_in_mv;
+}
@@ -3,8 +3,15 @@
 
 #pragma once
 
+#include "shared_config.h"
+
 void v_monitor_init();
 
 void v_monitor_sample(bool select_input);
 
 float v_monitor_voltage(bool print_result);
+
+/**
+ * Integer variant of \c v_monitor_voltage (running sum, no float or averaging loop)
+ */
+u32 v_monitor_voltage_mv(bool print_result);
@@ -26,3 +26,105 @@
 #ifndef MOD_WSLEDS_PIN
 #define MOD_WSLEDS_PIN              18
 #endif
+
+#ifndef MOD_WSLEDS_GAMMA
+#define MOD_WSLEDS_GAMMA            1.0f // 1.0 - linear passthrough, 2.2-2.8 for perceptually even fades
+#endif
+
+#ifndef MOD_WSLEDS_BRIGHTNESS
+#define MOD_WSLEDS_BRIGHTNESS       255
+#endif
+
+#ifndef MOD_WSLEDS_DITHER
+#define MOD_WSLEDS_DITHER           1
+#endif
+
+#ifndef MOD_WSLEDS_DMA_IRQ
+#define MOD_WSLEDS_DMA_IRQ          0 // DMA_IRQ_0 or DMA_IRQ_1 (shared handler)
+#endif
+
+#ifndef MOD_WSLEDS_LATCH_US
+#define MOD_WSLEDS_LATCH_US         50 // reset/latch low time, some newer WS2812B revisions want 280
+#endif
+
+#ifndef MOD_WSLEDS_SKIP_UNCHANGED
+#define MOD_WSLEDS_SKIP_UNCHANGED   1 // present skips DMA when frame hash didn't change
+#endif
+
+#ifndef MOD_WSLEDS_KEEPALIVE_MS
+#define MOD_WSLEDS_KEEPALIVE_MS     1000 // resend unchanged frame this often, 0 - never
+#endif
+
+// current limiter - frames estimated over budget get scaled down (after gamma/brightness, per instance budget)
+#ifndef MOD_WSLEDS_POWER_LIMIT_MA
+#define MOD_WSLEDS_POWER_LIMIT_MA   0 // default budget of every instance, 0 - no limit
+#endif
+
+#ifndef MOD_WSLEDS_MA_RED
+#define MOD_WSLEDS_MA_RED           16 // channel fully on, measured WS2812B at 5 V
+#endif
+
+#ifndef MOD_WSLEDS_MA_GREEN
+#define MOD_WSLEDS_MA_GREEN         11
+#endif
+
+#ifndef MOD_WSLEDS_MA_BLUE
+#define MOD_WSLEDS_MA_BLUE          15
+#endif
+
+#ifndef MOD_WSLEDS_MA_WHITE
+#define MOD_WSLEDS_MA_WHITE         18 // SK6812 RGBW white die
+#endif
+
+#ifndef MOD_WSLEDS_MA_IDLE
+#define MOD_WSLEDS_MA_IDLE          1 // per LED when dark (driver IC)
+#endif
+
+#ifndef MOD_WSLEDS_POWER_V_MONITOR
+#define MOD_WSLEDS_POWER_V_MONITOR  0 // 1 - budget shrinks as v_monitor_voltage_mv() sags (app keeps sampling)
+#endif
+
+#ifndef MOD_WSLEDS_POWER_FULL_MV
+#define MOD_WSLEDS_POWER_FULL_MV    11100 // full budget at and above (3S pack nominal)
+#endif
+
+#ifndef MOD_WSLEDS_POWER_LOW_MV
+#define MOD_WSLEDS_POWER_LOW_MV     9600 // MOD_WSLEDS_POWER_LOW_PERCENT of budget at and below
+#endif
+
+#ifndef MOD_WSLEDS_POWER_LOW_PERCENT
+#define MOD_WSLEDS_POWER_LOW_PERCENT 25
+#endif
+
+// parallel output - up to 8 strips on consecutive pins from one state machine (wsleds_parallel.h)
+#ifndef MOD_WSLEDS_PARALLEL_STRIPS
+#define MOD_WSLEDS_PARALLEL_STRIPS          8 // 1..8, strip N is on pin MOD_WSLEDS_PARALLEL_PIN_BASE + N
+#endif
+
+#ifndef MOD_WSLEDS_PARALLEL_LEDS_PER_STRIP
+#define MOD_WSLEDS_PARALLEL_LEDS_PER_STRIP  64 // shorter strips just get zeros at the end
+#endif
+
+#ifndef MOD_WSLEDS_PARALLEL_PIN_BASE
+#define MOD_WSLEDS_PARALLEL_PIN_BASE        6
+#endif
+
+#ifndef MOD_WSLEDS_PARALLEL_PIO
+#define MOD_WSLEDS_PARALLEL_PIO             pio1
+#endif
+
+#ifndef MOD_WSLEDS_PARALLEL_SM
+#define MOD_WSLEDS_PARALLEL_SM              0
+#endif
+
+#ifndef MOD_WSLEDS_PARALLEL_DMA_CH
+#define MOD_WSLEDS_PARALLEL_DMA_CH          2
+#endif
+
+#ifndef MOD_WSLEDS_FORMAT
+#define MOD_WSLEDS_FORMAT           WSLEDS_FORMAT_RGB // pixel format of default instance (wsleds_buffer)
+#endif
+
+#ifndef MOD_WSLEDS_MAX_INSTANCES
+#define MOD_WSLEDS_MAX_INSTANCES    4 // strips driven at the same time (default + wsledswhite + own wsleds_t)
+#endif
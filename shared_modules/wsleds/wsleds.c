@@ -4,7 +4,10 @@
 #include "wsleds.h"
 
 #include <hardware/dma.h>
+#include <hardware/irq.h>
 #include <hardware/pio.h>
+#include <hardware/pwm.h>
+#include <hardware/sync.h>
 #include <math.h>
 #include <pico/time.h>
 #include <pio_wsleds.pio.h>
@@ -12,60 +15,570 @@
 #include <string.h>
 
 #include "anim.h"
+#include "pixels.h"
 #include "utils.h"
 #include "wsleds_data.h"
 
+#if MOD_WSLEDS_POWER_V_MONITOR
+#include "../v_monitor/v_monitor.h"
+#endif
+
 // for square
 // static const u8 line_width = (u8)sqrt(MOD_WSLEDS_LED_COUNT);
 
+#define LUT_CHANNELS 4 // logical byte: B, G, R, W - bytes 0, 1, 2, 3
+#define CYCLES_PER_BIT 12
+#define PIO_TX_FIFO_DEPTH 8 // joined TX FIFO
+
+typedef struct {
+	u8 channels;
+	u8 wire_shift[4];
+	u32 cycle_ns;
+} format_info_t;
+
+static const format_info_t FORMATS[] = {
+	[WSLEDS_FORMAT_RGB] = { 3, { 16, 8, 0 }, 98 },
+	[WSLEDS_FORMAT_GRB] = { 3, { 8, 16, 0 }, 98 },
+	[WSLEDS_FORMAT_GRBW] = { 4, { 8, 16, 0, 24 }, 102 },
+	[WSLEDS_FORMAT_RGBW] = { 4, { 16, 8, 0, 24 }, 102 },
+};
+
+// per logical channel (B, G, R, W) when fully on
+static const u32 CHANNEL_MA[LUT_CHANNELS] = {
+	MOD_WSLEDS_MA_BLUE, MOD_WSLEDS_MA_GREEN, MOD_WSLEDS_MA_RED, MOD_WSLEDS_MA_WHITE
+};
+
 u32 wsleds_buffer[MOD_WSLEDS_LED_COUNT] = { 0 };
 
-void wsleds_buffer_transfer() {
-	dma_channel_transfer_from_buffer_now(MOD_WSLEDS_DMA_CH, wsleds_buffer, MOD_WSLEDS_LED_COUNT);
+static u32 default_output[2][WSLEDS_OUTPUT_WORDS(MOD_WSLEDS_LED_COUNT, MOD_WSLEDS_FORMAT)] = { };
+static u32 default_dither[MOD_WSLEDS_LED_COUNT] = { };
+static u16 default_remap[MOD_WSLEDS_LED_COUNT] = { };
+static wsleds_t default_leds = {
+	.format = MOD_WSLEDS_FORMAT,
+	.count = MOD_WSLEDS_LED_COUNT,
+	.buffer = wsleds_buffer,
+	.output = { default_output[0], default_output[1] },
+	.dither = default_dither,
+	.brightness_scale = MOD_WSLEDS_BRIGHTNESS + 1,
+	.dither_enabled = MOD_WSLEDS_DITHER,
+	.power_limit_ma = MOD_WSLEDS_POWER_LIMIT_MA,
+};
+
+static wsleds_t *instances[MOD_WSLEDS_MAX_INSTANCES] = { };
+static i32 program_offset[NUM_PIOS] = { };
+static u8 program_refs[NUM_PIOS] = { };
+static bool irq_installed = false;
+
+static u16 gamma_lut[LUT_CHANNELS][256] = { };
+static bool gamma_init = false;
+static u32 gamma_generation = 0; // part of frame hash - new LUTs resend unchanged frames
+
+static void build_gamma_lut(u16 lut[256], const float gamma) {
+	for (u32 i = 0; i < 256; i++) {
+		const float linear = gamma == 1.0f ? (float)i : powf((float)i / 255.0f, gamma) * 255.0f;
+		lut[i] = (u16)(linear * 256.0f + 0.5f); // 8.8, 255 -> 0xFF00
+	}
 }
 
-void wsleds_init() {
+static void ensure_gamma() {
+	if (likely(gamma_init)) return;
+	gamma_init = true;
+	for (u32 ch = 0; ch < LUT_CHANNELS; ch++) build_gamma_lut(gamma_lut[ch], MOD_WSLEDS_GAMMA);
+}
+
+void wsleds_set_gamma(const float r, const float g, const float b) {
+	ensure_gamma();
+	build_gamma_lut(gamma_lut[2], r);
+	build_gamma_lut(gamma_lut[1], g);
+	build_gamma_lut(gamma_lut[0], b);
+	gamma_generation++;
+}
+
+void wsleds_set_gamma_white(const float w) {
+	ensure_gamma();
+	build_gamma_lut(gamma_lut[3], w);
+	gamma_generation++;
+}
+
+void wsleds_instance_set_brightness(wsleds_t *leds, const u8 brightness) {
+	leds->brightness_scale = brightness + 1;
+	leds->dirty = true;
+}
+
+u8 wsleds_instance_get_brightness(const wsleds_t *leds) {
+	return (u8)(leds->brightness_scale - 1);
+}
+
+void wsleds_instance_set_dither(wsleds_t *leds, const bool enabled) {
+	leds->dither_enabled = enabled && leds->dither != nullptr;
+	if (!enabled && leds->dither != nullptr) memset(leds->dither, 0, leds->count * sizeof(u32));
+	leds->dirty = true;
+}
+
+void wsleds_instance_set_power_limit(wsleds_t *leds, const u32 budget_ma) {
+	leds->power_limit_ma = budget_ma;
+	leds->dirty = true;
+}
+
+void wsleds_instance_set_skip_unchanged(wsleds_t *leds, const bool enabled, const u32 keepalive_ms) {
+	leds->skip_unchanged = enabled;
+	leds->keepalive_us = keepalive_ms * 1000;
+	leds->dirty = true;
+}
+
+void wsleds_instance_invalidate(wsleds_t *leds) {
+	leds->dirty = true;
+}
+
+wsleds_stats_t wsleds_instance_get_stats(const wsleds_t *leds) {
+	return (wsleds_stats_t){
+		.presented = leds->presented,
+		.skipped = leds->skipped,
+		.limited = leds->limited,
+		.frame_ma = leds->frame_ma,
+		.sent_ma = leds->sent_ma,
+	};
+}
+
+void wsleds_instance_reset_stats(wsleds_t *leds) {
+	leds->presented = 0;
+	leds->skipped = 0;
+	leds->limited = 0;
+}
+
+static inline u32 hash_word(const u32 hash, const u32 word) {
+	const u32 x = hash ^ word;
+	return (x << 5 | x >> 27) * 0x9E3779B1u;
+}
+
+static inline u32 output_words(const wsleds_t *leds) {
+	return WSLEDS_OUTPUT_WORDS(leds->count, leds->format);
+}
+
+// budget for this frame, 0 - no limit
+static u32 power_budget(const wsleds_t *leds) {
+	const u32 budget = leds->power_limit_ma;
+#if MOD_WSLEDS_POWER_V_MONITOR
+	if (budget == 0) return 0;
+	const u32 mv = v_monitor_voltage_mv(false);
+	if (mv >= MOD_WSLEDS_POWER_FULL_MV) return budget;
+	if (mv <= MOD_WSLEDS_POWER_LOW_MV) return budget * MOD_WSLEDS_POWER_LOW_PERCENT / 100;
+	const u32 percent = MOD_WSLEDS_POWER_LOW_PERCENT
+	                    + (100 - MOD_WSLEDS_POWER_LOW_PERCENT) * (mv - MOD_WSLEDS_POWER_LOW_MV)
+	                      / (MOD_WSLEDS_POWER_FULL_MV - MOD_WSLEDS_POWER_LOW_MV);
+	return (u32)((u64)budget * percent / 100);
+#else
+	return budget;
+#endif
+}
+
+// cheap change detection (not cryptographic) - source pixels, palette, gamma LUT generation and, while it bites,
+// the power budget (frame_ma is the same for unchanged pixels, so only a budget below it changes the hash)
+static u32 frame_hash(const wsleds_t *leds, const u32 budget_ma) {
+	u32 hash = hash_word(0x811C9DC5u, gamma_generation);
+	if (budget_ma != 0) hash = hash_word(hash, budget_ma < leds->frame_ma ? budget_ma : leds->frame_ma);
+	if (leds->indexed != nullptr) {
+		const u8 *indexed = leds->indexed;
+		u32 i = 0;
+		for (; i + 4 <= leds->count; i += 4) {
+			hash = hash_word(hash, indexed[i] | indexed[i + 1] << 8 | indexed[i + 2] << 16 | (u32)indexed[i + 3] << 24);
+		}
+		for (; i < leds->count; i++) hash = hash_word(hash, indexed[i]);
+		for (u32 p = 0; p < 256; p++) hash = hash_word(hash, leds->palette[p]);
+	} else {
+		for (u32 i = 0; i < leds->count; i++) hash = hash_word(hash, leds->buffer[i]);
+	}
+	return hash;
+}
+
+// estimates frame draw from wire byte sums and scales the whole frame down when it's over budget
+static void limit_power(wsleds_t *leds, u32 *output, const u32 sums[LUT_CHANNELS], const u32 budget_ma) {
+	u64 color_ma_255 = 0;
+	for (u32 k = 0; k < leds->channels; k++) color_ma_255 += (u64)sums[k] * CHANNEL_MA[leds->wire_shift[k] >> 3];
+	const u32 color_ma = (u32)(color_ma_255 / 255);
+	const u32 idle_ma = leds->count * MOD_WSLEDS_MA_IDLE;
+	leds->frame_ma = idle_ma + color_ma;
+	leds->sent_ma = leds->frame_ma;
+	if (budget_ma == 0 || leds->frame_ma <= budget_ma || color_ma == 0) return;
+
+	// whole frame by one factor keeps hues and relative brightness, output bytes are per channel so SWAR works
+	const u32 available = budget_ma > idle_ma ? budget_ma - idle_ma : 0;
+	const u32 scale = (u32)(((u64)available << 8) / color_ma);
+	pixels_scale(output, output_words(leds), scale);
+	leds->sent_ma = idle_ma + (color_ma * scale >> 8);
+	leds->limited++;
+}
+
+// palette lookup -> gamma -> brightness -> temporal dither -> wire order -> current limit, logical 0xWWRRGGBB in,
+// packed wire bytes out
+static void prepare_output(wsleds_t *leds, u32 *output, const u32 budget_ma) {
+	ensure_gamma();
+
+	const u32 scale = leds->brightness_scale;
+	const u32 channels = leds->channels;
+	const bool dither_enabled = leds->dither_enabled;
+	const u32 *buffer = leds->buffer;
+	const u8 *indexed = leds->indexed;
+	const u32 *palette = leds->palette;
+	const u16 *remap = leds->remap;
+	u32 *dither = leds->dither;
+	u8 *out = (u8 *)output;
+	u32 residuals = 0;
+	u32 sums[LUT_CHANNELS] = { };
+
+	for (u32 i = 0; i < leds->count; i++) {
+		const u32 src = remap != nullptr ? remap[i] : i;
+		const u32 color = indexed != nullptr ? palette[indexed[src]] : buffer[src];
+		const u32 residual = dither_enabled ? dither[i] : 0;
+		u32 next_residual = 0;
+
+		for (u32 k = 0; k < channels; k++) {
+			const u32 shift = leds->wire_shift[k];
+			u32 value = (gamma_lut[shift >> 3][(color >> shift) & 0xFF] * scale) >> 8; // 8.8, max 0xFF00
+			if (dither_enabled) {
+				value += (residual >> shift) & 0xFF;
+				next_residual |= (value & 0xFF) << shift;
+			}
+			*out++ = (u8)(value >> 8);
+			sums[k] += value >> 8;
+		}
+
+		if (dither_enabled) dither[i] = next_residual;
+		residuals |= next_residual;
+	}
+
+	leds->dither_live = residuals != 0; // fractions left - same input still gives different output next frame
+	limit_power(leds, output, sums, budget_ma);
+}
+
+void wsleds_instance_set_geometry(wsleds_t *leds, const wsleds_geometry_t *geometry, u16 *remap) {
+	const u32 w = geometry->width;
+	const u32 h = geometry->height;
+	const u32 pw = geometry->panel_width ? geometry->panel_width : w;
+	const u32 ph = geometry->panel_height ? geometry->panel_height : h;
+	if (w * h != leds->count) utils_error_mode(29);
+	if (!(pw <= w && w % pw == 0 && ph <= h && h % ph == 0)) utils_error_mode(29); // panels must tile the area
+	leds->remap = nullptr; // don't present half built LUT
+	wsleds_geometry_build(geometry, remap);
+	leds->remap = remap;
+	leds->dirty = true;
+}
+
+void wsleds_instance_clear_geometry(wsleds_t *leds) {
+	leds->remap = nullptr;
+	leds->dirty = true;
+}
+
+static void start_transfer(wsleds_t *leds, const u8 index) {
+	leds->front = index;
+	leds->busy = true;
+	leds->pending = false;
+	dma_channel_transfer_from_buffer_now(leds->dma_ch, leds->output[index], output_words(leds));
+}
+
+static i64 latch_done(alarm_id_t, void *user_data) {
+	wsleds_t *leds = user_data;
+	leds->busy = false;
+	if (leds->pending) start_transfer(leds, leds->front ^ 1);
+	return 0;
+}
+
+static void dma_irq_handler() {
+	for (u32 i = 0; i < MOD_WSLEDS_MAX_INSTANCES; i++) {
+		wsleds_t *leds = instances[i];
+		if (leds == nullptr || !dma_irqn_get_channel_status(MOD_WSLEDS_DMA_IRQ, leds->dma_ch)) continue;
+		dma_irqn_acknowledge_channel(MOD_WSLEDS_DMA_IRQ, leds->dma_ch);
+
+		// DMA is done, but FIFO + OSR are still shifting out - free the line after they drain and latch passes
+		if (unlikely(add_alarm_in_us(leds->drain_latch_us, latch_done, leds, true) < 0)) {
+			busy_wait_us(leds->drain_latch_us); // no alarm slot - still can't restart before the latch passed
+			latch_done(0, leds);
+		}
+	}
+}
+
+// auto refresh - hardware keeps resending front, CPU only prepares back and swaps the pointer control DMA reads
+static void present_auto(wsleds_t *leds, const u32 budget_ma) {
+	const u8 back = leds->front ^ 1;
+	const uintptr_t from = (uintptr_t)leds->output[back];
+	const uintptr_t to = from + output_words(leds) * sizeof(u32);
+
+	// a frame triggered just before the last swap may still be streaming old front (now back)
+	while (dma_channel_is_busy(leds->dma_ch)) {
+		const uintptr_t read_addr = dma_hw->ch[leds->dma_ch].read_addr;
+		if (read_addr < from || read_addr > to) break;
+		tight_loop_contents();
+	}
+
+	prepare_output(leds, leds->output[back], budget_ma);
+	leds->auto_read_addr = leds->output[back]; // single word write - next PWM wrap picks it up
+	leds->front = back;
+	leds->presented++;
+	leds->last_sent_us = time_us_32();
+}
+
+void wsleds_instance_present(wsleds_t *leds) {
+	const u32 budget_ma = power_budget(leds);
+	if (leds->skip_unchanged) {
+		const u32 hash = frame_hash(leds, budget_ma);
+		const bool stale = leds->keepalive_us != 0 && time_us_32() - leds->last_sent_us >= leds->keepalive_us;
+		if (hash == leds->last_hash && !leds->dirty && !leds->dither_live && !stale) {
+			leds->skipped++;
+			return;
+		}
+		leds->last_hash = hash;
+		leds->dirty = false;
+	}
+
+	if (leds->auto_refresh) {
+		present_auto(leds, budget_ma);
+		return;
+	}
+
+	auto irq_state = save_and_disable_interrupts();
+	leds->pending = false; // back is being rewritten - don't let latch_done start it half way (newest frame wins)
+	const u8 back = leds->front ^ 1;
+	restore_interrupts(irq_state);
+
+	prepare_output(leds, leds->output[back], budget_ma);
+
+	irq_state = save_and_disable_interrupts();
+	if (!leds->busy) start_transfer(leds, back);
+	else leds->pending = true;
+	restore_interrupts(irq_state);
+
+	leds->presented++;
+	leds->last_sent_us = time_us_32();
+}
+
+bool wsleds_instance_is_busy(const wsleds_t *leds) {
+	if (leds->auto_refresh) return dma_channel_is_busy(leds->dma_ch);
+	return leds->busy || leds->pending;
+}
+
+void wsleds_instance_wait_idle(const wsleds_t *leds) {
+	while (wsleds_instance_is_busy(leds)) tight_loop_contents();
+}
+
+u32 wsleds_instance_frame_us(const wsleds_t *leds) {
+	return leds->count * leds->channels * 8 * CYCLES_PER_BIT * leds->cycle_ns / 1000 + leds->drain_latch_us;
+}
+
+static i32 program_acquire(const PIO pio) {
+	const auto index = pio_get_index(pio);
+	if (program_refs[index] == 0) {
+		program_offset[index] = pio_add_program(pio, &pio_wsleds_program);
+		if (program_offset[index] < 0) utils_error_mode(26);
+	}
+	program_refs[index]++;
+	return program_offset[index];
+}
+
+static void program_release(const PIO pio) {
+	const auto index = pio_get_index(pio);
+	if (program_refs[index] == 0) return;
+	if (--program_refs[index] == 0) pio_remove_program(pio, &pio_wsleds_program, program_offset[index]);
+}
+
+void wsleds_instance_init(wsleds_t *leds) {
+	const auto format = &FORMATS[leds->format];
+	leds->channels = format->channels;
+	memcpy(leds->wire_shift, format->wire_shift, sizeof leds->wire_shift);
+	leds->cycle_ns = format->cycle_ns;
+	leds->front = 0;
+	leds->busy = false;
+	leds->pending = false;
+	if (leds->brightness_scale == 0) leds->brightness_scale = MOD_WSLEDS_BRIGHTNESS + 1;
+	wsleds_instance_set_skip_unchanged(leds, MOD_WSLEDS_SKIP_UNCHANGED, MOD_WSLEDS_KEEPALIVE_MS);
+	wsleds_instance_reset_stats(leds);
+	wsleds_instance_set_dither(leds, leds->dither_enabled);
+
+	// register for DMA completion IRQ
+	u32 slot = 0;
+	while (slot < MOD_WSLEDS_MAX_INSTANCES && instances[slot] != nullptr) slot++;
+	if (slot == MOD_WSLEDS_MAX_INSTANCES) utils_error_mode(28);
+
 	// init DMA
-	if (dma_channel_is_claimed(MOD_WSLEDS_DMA_CH)) utils_error_mode(25);
-	dma_channel_claim(MOD_WSLEDS_DMA_CH);
-	dma_channel_config dma_c = dma_channel_get_default_config(MOD_WSLEDS_DMA_CH);
+	if (dma_channel_is_claimed(leds->dma_ch)) utils_error_mode(25);
+	dma_channel_claim(leds->dma_ch);
+	dma_channel_config dma_c = dma_channel_get_default_config(leds->dma_ch);
 	channel_config_set_transfer_data_size(&dma_c, DMA_SIZE_32);
-	channel_config_set_read_increment(&dma_c, true); // incr true - we loop through MOD_WSLEDS_LED_COUNT size buffer
+	channel_config_set_read_increment(&dma_c, true); // incr true - we loop through packed output buffer
 	channel_config_set_write_increment(&dma_c, false);
-	channel_config_set_dreq(&dma_c, pio_get_dreq(MOD_WSLEDS_PIO, MOD_WSLEDS_SM, true));
-	dma_channel_configure(MOD_WSLEDS_DMA_CH, &dma_c, &MOD_WSLEDS_PIO->txf[MOD_WSLEDS_SM], wsleds_buffer, MOD_WSLEDS_LED_COUNT,
+	channel_config_set_bswap(&dma_c, true); // output is a byte stream, PIO shifts MSB first
+	channel_config_set_dreq(&dma_c, pio_get_dreq(leds->pio, leds->sm, true));
+	dma_channel_configure(leds->dma_ch, &dma_c, &leds->pio->txf[leds->sm], leds->output[0], output_words(leds),
 	                      false);
+
+	// completion IRQ - drives latch pacing and queued frames
+	leds->drain_latch_us = (PIO_TX_FIFO_DEPTH + 1) * 32 * CYCLES_PER_BIT * leds->cycle_ns / 1000
+	                       + MOD_WSLEDS_LATCH_US + 1;
+	instances[slot] = leds;
+	if (!irq_installed) {
+		irq_add_shared_handler(DMA_IRQ(MOD_WSLEDS_DMA_IRQ), dma_irq_handler,
+		                       PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+		irq_set_enabled(DMA_IRQ(MOD_WSLEDS_DMA_IRQ), true);
+		irq_installed = true;
+	}
+	dma_irqn_set_channel_enabled(MOD_WSLEDS_DMA_IRQ, leds->dma_ch, true);
 	sleep_ms(1);
 
 	// get clock divider
-	const auto clk_div = utils_calculate_pio_clk_div_ns(98);
+	const auto clk_div = utils_calculate_pio_clk_div_ns(leds->cycle_ns);
 	utils_printf("WSLEDS PIO CLK DIV: %f\n", clk_div);
 
-	// init PIO
-	const auto offset = pio_add_program(MOD_WSLEDS_PIO, &pio_wsleds_program);
-	if (offset < 0) utils_error_mode(26);
-	if (pio_sm_is_claimed(MOD_WSLEDS_PIO, MOD_WSLEDS_SM)) utils_error_mode(27);
-	pio_sm_claim(MOD_WSLEDS_PIO, MOD_WSLEDS_SM);
-	pio_wsleds_program_init(MOD_WSLEDS_PIO, MOD_WSLEDS_SM, offset, MOD_WSLEDS_PIN, clk_div);
-	pio_sm_set_enabled(MOD_WSLEDS_PIO, MOD_WSLEDS_SM, true);
+	// init PIO - program is shared by every instance on the same PIO block
+	const auto offset = program_acquire(leds->pio);
+	if (pio_sm_is_claimed(leds->pio, leds->sm)) utils_error_mode(27);
+	pio_sm_claim(leds->pio, leds->sm);
+	pio_wsleds_program_init(leds->pio, leds->sm, offset, leds->pin, clk_div);
+	pio_sm_set_enabled(leds->pio, leds->sm, true);
 	sleep_ms(1);
+}
+
+void wsleds_instance_start_auto(wsleds_t *leds, const u8 ctrl_dma_ch, const u8 pwm_slice, u32 fps) {
+	if (leds->auto_refresh) return;
+	wsleds_instance_wait_idle(leds);
+
+	const u32 max_fps = 1'000'000 / wsleds_instance_frame_us(leds);
+	if (fps == 0 || fps > max_fps) { // 0 would leave PWM at divider 1 - re-triggers mid frame
+		utils_printf("!!! WSLEDS AUTO FPS %lu OUT OF RANGE, USING %lu\n", (unsigned long)fps, (unsigned long)max_fps);
+		fps = max_fps;
+	}
+
+	// completion IRQ would start latch alarms - pacing is done by PWM now
+	dma_irqn_set_channel_enabled(MOD_WSLEDS_DMA_IRQ, leds->dma_ch, false);
+	dma_channel_set_trans_count(leds->dma_ch, output_words(leds), false); // reloaded on every trigger
+	leds->auto_read_addr = leds->output[leds->front];
+	leds->auto_ctrl_ch = ctrl_dma_ch;
+	leds->auto_pwm_slice = pwm_slice;
+
+	// control channel - one word per PWM wrap: front pointer -> data channel read address + trigger
+	if (dma_channel_is_claimed(ctrl_dma_ch)) utils_error_mode(25);
+	dma_channel_claim(ctrl_dma_ch);
+	dma_channel_config dma_c = dma_channel_get_default_config(ctrl_dma_ch);
+	channel_config_set_transfer_data_size(&dma_c, DMA_SIZE_32);
+	channel_config_set_read_increment(&dma_c, false);
+	channel_config_set_write_increment(&dma_c, false);
+	channel_config_set_dreq(&dma_c, pwm_get_dreq(pwm_slice));
+	dma_channel_configure(ctrl_dma_ch, &dma_c, &dma_hw->ch[leds->dma_ch].al3_read_addr_trig, &leds->auto_read_addr,
+	                      dma_encode_endless_transfer_count(), true);
+
+	// PWM slice as frame timer - DMA pacing timers can't go below ~2.3 kHz (16 bit X/Y fraction of sys clock)
+	pwm_set_wrap(pwm_slice, UINT16_MAX);
+	const auto div = utils_calculate_pwm_divider_fx(UINT16_MAX, fps);
+	pwm_set_clkdiv_int_frac4(pwm_slice, div >> 4, div & 0xF);
+	pwm_set_counter(pwm_slice, 0);
+	leds->auto_refresh = true;
+	pwm_set_enabled(pwm_slice, true);
+}
+
+void wsleds_instance_stop_auto(wsleds_t *leds) {
+	if (!leds->auto_refresh) return;
+
+	pwm_set_enabled(leds->auto_pwm_slice, false);
+	dma_channel_abort(leds->auto_ctrl_ch);
+	dma_channel_unclaim(leds->auto_ctrl_ch);
+	dma_channel_wait_for_finish_blocking(leds->dma_ch);
+
+	leds->busy = false;
+	leds->pending = false;
+	leds->auto_refresh = false;
+	dma_irqn_acknowledge_channel(MOD_WSLEDS_DMA_IRQ, leds->dma_ch); // raised by every auto frame - no stale latch alarm
+	dma_irqn_set_channel_enabled(MOD_WSLEDS_DMA_IRQ, leds->dma_ch, true);
+	busy_wait_us(leds->drain_latch_us);
+}
+
+void wsleds_instance_deinit(wsleds_t *leds) {
+	wsleds_instance_stop_auto(leds);
+	wsleds_instance_wait_idle(leds);
+
+	pio_sm_set_enabled(leds->pio, leds->sm, false);
+	pio_sm_unclaim(leds->pio, leds->sm);
+	program_release(leds->pio);
+
+	dma_irqn_set_channel_enabled(MOD_WSLEDS_DMA_IRQ, leds->dma_ch, false);
+	dma_channel_unclaim(leds->dma_ch);
+	for (u32 i = 0; i < MOD_WSLEDS_MAX_INSTANCES; i++) {
+		if (instances[i] == leds) instances[i] = nullptr;
+	}
+}
+
+wsleds_t *wsleds_default() {
+	return &default_leds;
+}
+
+void wsleds_init() {
+	default_leds.pio = MOD_WSLEDS_PIO;
+	default_leds.sm = MOD_WSLEDS_SM;
+	default_leds.dma_ch = MOD_WSLEDS_DMA_CH;
+	default_leds.pin = MOD_WSLEDS_PIN;
+	wsleds_instance_init(&default_leds);
 
 	// buffer_transfer();
 }
 
-void wsleds_rotate_buffer_left(const u8 times) {
-	static u32 temp[MOD_WSLEDS_LED_COUNT] = { 0 };
+void wsleds_present() {
+	wsleds_instance_present(&default_leds);
+}
+
+void wsleds_buffer_transfer() {
+	wsleds_present();
+}
+
+bool wsleds_is_busy() {
+	return wsleds_instance_is_busy(&default_leds);
+}
+
+void wsleds_wait_idle() {
+	wsleds_instance_wait_idle(&default_leds);
+}
+
+u32 wsleds_frame_us() {
+	return wsleds_instance_frame_us(&default_leds);
+}
+
+void wsleds_set_brightness(const u8 brightness) {
+	wsleds_instance_set_brightness(&default_leds, brightness);
+}
+
+u8 wsleds_get_brightness() {
+	return wsleds_instance_get_brightness(&default_leds);
+}
+
+void wsleds_set_dither(const bool enabled) {
+	wsleds_instance_set_dither(&default_leds, enabled);
+}
+
+void wsleds_set_power_limit(const u32 budget_ma) {
+	wsleds_instance_set_power_limit(&default_leds, budget_ma);
+}
+
+wsleds_stats_t wsleds_get_stats() {
+	return wsleds_instance_get_stats(&default_leds);
+}
+
+void wsleds_set_geometry(const wsleds_geometry_t *geometry) {
+	wsleds_instance_set_geometry(&default_leds, geometry, default_remap);
+}
+
+void wsleds_rotate_left(u32 *buffer, const u8 times) {
+	u32 temp[64];
 	if (times == 0) return;
 
 	for (auto t = 0; t < times; t++) {
-		for (auto i = 0; i < 8; i++) for (auto j = 0; j < 8; j++) temp[(7 - j) * 8 + i] = wsleds_buffer[i * 8 + j];
+		for (auto i = 0; i < 8; i++) for (auto j = 0; j < 8; j++) temp[(7 - j) * 8 + i] = buffer[i * 8 + j];
 
-		for (auto i = 0; i < MOD_WSLEDS_LED_COUNT; i++) {
-			wsleds_buffer[i] = temp[i];
+		for (auto i = 0; i < 64; i++) {
+			buffer[i] = temp[i];
 		}
 	}
 }
 
+void wsleds_rotate_buffer_left(const u8 times) {
+	wsleds_rotate_left(wsleds_buffer, times);
+}
+
 // static void anim_countdown() {
 // 	static bool init = false;
 // 	static i8 number = 0;
@@ -90,8 +603,8 @@ void wsleds_rotate_buffer_left(const u8 times) {
 //
 // 	if (frame % FRAME_TICKS == 0) {
 // 		if (number >= 0) {
-// 			memcpy(wsleds_buffer, WSLEDS_NUMBERS[number], sizeof(wsleds_buffer));
-// 			rotate_buffer_left(3);
+// 			memset(wsleds_buffer, 0, sizeof(wsleds_buffer));
+// 			gfx_char(&canvas, &GFX_FONT_DIGITS_8X8, 0, 0, '0' + number, COLOR_WHITE); // rotation - set geometry
 // 		}
 // 		number--;
 // 	}
@@ -4,11 +4,276 @@
 #pragma once
 
 #include "shared_config.h"
+#include "wsleds_geometry.h"
+
+/*
+ * WS2812/SK6812 driver with runtime instances - every wsleds_t has its own pin, SM, DMA channel, LED count and pixel
+ * format. Buffers always hold logical 0xWWRRGGBB colors (W is ignored on RGB strips), wire order is applied when
+ * preparing the output. All instances on the same PIO block share one loaded program.
+ * Output is a packed byte stream (3 bytes per RGB led, 4 per RGBW), so nothing is wasted on padding.
+ * Indexed instances draw 1 byte palette indices instead of u32 colors, expanded while preparing the output.
+ * wsleds_* functions without instance work on the default instance (wsleds_buffer, MOD_WSLEDS_* config).
+ */
+
+typedef enum {
+	WSLEDS_FORMAT_RGB, // 24 bit, R first (original wsleds wiring)
+	WSLEDS_FORMAT_GRB, // 24 bit, G first (WS2812B)
+	WSLEDS_FORMAT_GRBW, // 32 bit, SK6812 RGBW (original wsledswhite wiring)
+	WSLEDS_FORMAT_RGBW, // 32 bit
+} wsleds_format_t;
+
+#define WSLEDS_BYTES_PER_LED(format)        ((format) == WSLEDS_FORMAT_GRBW || (format) == WSLEDS_FORMAT_RGBW ? 4 : 3)
+#define WSLEDS_OUTPUT_WORDS(count, format)  (((count) * WSLEDS_BYTES_PER_LED(format) + 3) / 4)
+
+typedef struct {
+	u32 presented; // frames sent (incl. keep-alive refreshes)
+	u32 skipped; // presents skipped because nothing changed
+	u32 limited; // frames scaled down by the current limiter
+	u32 frame_ma; // estimated draw of the last frame as drawn (before limiting)
+	u32 sent_ma; // estimated draw of the last frame as sent
+} wsleds_stats_t;
+
+typedef struct {
+	// config - set before wsleds_instance_init (WSLEDS_INSTANCE fills storage, count and format)
+	PIO pio;
+	u8 sm;
+	u8 dma_ch;
+	u8 pin;
+	wsleds_format_t format;
+	u16 count;
+	u32 *buffer; // logical colors, drawn by the app (nullptr for indexed instances)
+	u8 *indexed; // palette indices, drawn by the app instead of buffer (nullptr for color instances)
+	const u32 *palette; // 256 logical colors for indexed, can be swapped any time (palette animation)
+	u32 *output[2]; // packed wire bytes, WSLEDS_OUTPUT_WORDS each, front is streamed by DMA, back gets prepared
+	u32 *dither; // per channel 8.8 remainder, byte per channel like color (nullptr - no dithering)
+	const u16 *remap; // physical -> logical index (wsleds_instance_set_geometry), nullptr - identity
+	u32 power_limit_ma; // current budget for the LEDs, 0 - no limit (wsleds_instance_set_power_limit)
+
+	// runtime
+	volatile u8 front;
+	volatile bool busy; // DMA streaming or PIO draining/latching
+	volatile bool pending; // back buffer ready, starts as soon as latch is over
+	u8 channels;
+	u8 wire_shift[4]; // logical byte shift for each wire byte, first sent first
+	u16 brightness_scale; // 1..256
+	bool dither_enabled;
+	u32 drain_latch_us;
+	u32 cycle_ns;
+
+	// unchanged frame detection
+	bool skip_unchanged;
+	bool dirty; // settings changed - next present is sent even if pixels hash the same
+	bool dither_live; // dither still carries fractions, output changes on its own
+	u32 last_hash;
+	u32 last_sent_us;
+	u32 keepalive_us; // 0 - never refresh unchanged frame
+	u32 presented;
+	u32 skipped;
+
+	// current limiter
+	u32 limited;
+	u32 frame_ma;
+	u32 sent_ma;
+
+	// autonomous refresh
+	bool auto_refresh;
+	u8 auto_ctrl_ch;
+	u8 auto_pwm_slice;
+	u32 *volatile auto_read_addr; // front buffer, read by control DMA channel on every PWM wrap
+} wsleds_t;
+
+/**
+ * Declares static storage and instance for \c led_count LEDs, e.g. WSLEDS_INSTANCE(ring, 24, WSLEDS_FORMAT_GRB);
+ * then set pio/sm/dma_ch/pin and call wsleds_instance_init(&ring). 16 bytes per LED (with dither).
+ */
+#define WSLEDS_INSTANCE(name, led_count, pixel_format)                                                                  \
+	static u32 name##_buffer[led_count];                                                                                \
+	static u32 name##_output[2][WSLEDS_OUTPUT_WORDS(led_count, pixel_format)];                                          \
+	static u32 name##_dither[led_count];                                                                                \
+	static wsleds_t name = {                                                                                            \
+		.format = pixel_format,                                                                                         \
+		.count = led_count,                                                                                             \
+		.buffer = name##_buffer,                                                                                        \
+		.output = { name##_output[0], name##_output[1] },                                                               \
+		.dither = name##_dither,                                                                                        \
+		.brightness_scale = MOD_WSLEDS_BRIGHTNESS + 1,                                                                  \
+		.dither_enabled = MOD_WSLEDS_DITHER,                                                                            \
+		.power_limit_ma = MOD_WSLEDS_POWER_LIMIT_MA,                                                                    \
+	}
+
+/**
+ * Same as \c WSLEDS_INSTANCE, but app draws palette indices into \c name##_indexed - 7 bytes per RGB LED (no dither)
+ *
+ * @param palette_ptr 256 entry logical color palette
+ */
+#define WSLEDS_INSTANCE_INDEXED(name, led_count, pixel_format, palette_ptr)                                             \
+	static u8 name##_indexed[led_count];                                                                                \
+	static u32 name##_output[2][WSLEDS_OUTPUT_WORDS(led_count, pixel_format)];                                          \
+	static wsleds_t name = {                                                                                            \
+		.format = pixel_format,                                                                                         \
+		.count = led_count,                                                                                             \
+		.indexed = name##_indexed,                                                                                      \
+		.palette = palette_ptr,                                                                                         \
+		.output = { name##_output[0], name##_output[1] },                                                               \
+		.brightness_scale = MOD_WSLEDS_BRIGHTNESS + 1,                                                                  \
+		.power_limit_ma = MOD_WSLEDS_POWER_LIMIT_MA,                                                                    \
+	}
 
 extern u32 wsleds_buffer[MOD_WSLEDS_LED_COUNT];
 
+/**
+ * Claims DMA channel and SM, loads (or reuses) PIO program on \c leds->pio
+ */
+void wsleds_instance_init(wsleds_t *leds);
+
+/**
+ * Waits for the last frame, releases DMA channel and SM, unloads PIO program when no other instance uses it
+ */
+void wsleds_instance_deinit(wsleds_t *leds);
+
+/**
+ * Prepares \c leds->buffer into the back buffer and swaps - starts right away if the line is idle, otherwise
+ * as soon as the current frame is sent and latched. Returns without waiting, so the buffer can be
+ * drawn again while the previous frame is still streaming.
+ */
+void wsleds_instance_present(wsleds_t *leds);
+
+/**
+ * @return \c true while a frame is streaming, latching or queued
+ */
+bool wsleds_instance_is_busy(const wsleds_t *leds);
+
+void wsleds_instance_wait_idle(const wsleds_t *leds);
+
+/**
+ * @return Minimum time between frames (transfer + FIFO drain + latch) - useful for frame pacing
+ */
+u32 wsleds_instance_frame_us(const wsleds_t *leds);
+
+/**
+ * Multiplicative brightness, applied when preparing DMA buffer (keeps hue, unlike \c anim_reduce_brightness)
+ */
+void wsleds_instance_set_brightness(wsleds_t *leds, u8 brightness);
+
+u8 wsleds_instance_get_brightness(const wsleds_t *leds);
+
+/**
+ * Current limiter - every prepared frame is estimated from its per-channel byte sums (MOD_WSLEDS_MA_* constants,
+ * after gamma and brightness) and scaled down to fit \c budget_ma. With MOD_WSLEDS_POWER_V_MONITOR the budget
+ * shrinks linearly from MOD_WSLEDS_POWER_FULL_MV to MOD_WSLEDS_POWER_LOW_MV.
+ *
+ * @param budget_ma Whole strip including idle draw, 0 - no limit
+ */
+void wsleds_instance_set_power_limit(wsleds_t *leds, u32 budget_ma);
+
+/**
+ * Temporal dithering - carries fractional 8.8 remainder from frame to frame, so low brightness fades don't step
+ * @attention Works best when frames are sent at steady rate, needs \c leds->dither storage
+ */
+void wsleds_instance_set_dither(wsleds_t *leds, bool enabled);
+
+/**
+ * Autonomous refresh - PWM slice wraps at \c fps and paces a control DMA channel that re-triggers the data channel
+ * with the current front buffer. Frames go out at fixed rate with no CPU involvement, present only prepares
+ * the back buffer and swaps the pointer (waits only if the old front is still streaming).
+ * \c fps is clamped to what the strip can do (\c wsleds_instance_frame_us), 0 also runs at that maximum.
+ *
+ * @param ctrl_dma_ch Free DMA channel, claimed until \c wsleds_instance_stop_auto
+ * @param pwm_slice Free PWM slice used only as timer (no pin), 9 fps minimum
+ */
+void wsleds_instance_start_auto(wsleds_t *leds, u8 ctrl_dma_ch, u8 pwm_slice, u32 fps);
+
+/**
+ * Back to CPU driven presents, waits for the frame in flight
+ */
+void wsleds_instance_stop_auto(wsleds_t *leds);
+
+/**
+ * Unchanged frame detection - present hashes the source pixels (and palette) and skips DMA when nothing changed
+ * since the last sent frame, unless dither still has fractions to carry or settings changed
+ *
+ * @param keepalive_ms Resend unchanged frame at least this often (recovers LEDs after line glitches), 0 - never
+ */
+void wsleds_instance_set_skip_unchanged(wsleds_t *leds, bool enabled, u32 keepalive_ms);
+
+/**
+ * Forces next present to be sent - e.g. after editing palette or remap LUT in place
+ */
+void wsleds_instance_invalidate(wsleds_t *leds);
+
+wsleds_stats_t wsleds_instance_get_stats(const wsleds_t *leds);
+
+void wsleds_instance_reset_stats(wsleds_t *leds);
+
+/**
+ * Builds geometry LUT into \c remap and starts using it from the next present, buffer becomes logical (x, y) canvas.
+ * \c width * \c height must be \c leds->count and panels must tile it exactly (error mode 29 otherwise).
+ *
+ * @param remap \c leds->count entries, must stay valid (static)
+ */
+void wsleds_instance_set_geometry(wsleds_t *leds, const wsleds_geometry_t *geometry, u16 *remap);
+
+/**
+ * Back to physical order (no remap)
+ */
+void wsleds_instance_clear_geometry(wsleds_t *leds);
+
+/**
+ * @return Default instance (wsleds_buffer)
+ */
+wsleds_t *wsleds_default();
+
 void wsleds_init();
 
+/**
+ * Same as \c wsleds_instance_present for the default instance
+ */
+void wsleds_present();
+
+/**
+ * Same as \c wsleds_present
+ */
 void wsleds_buffer_transfer();
 
+bool wsleds_is_busy();
+
+void wsleds_wait_idle();
+
+u32 wsleds_frame_us();
+
+/**
+ * Same as \c wsleds_instance_set_geometry for the default instance (LUT storage is built in)
+ */
+void wsleds_set_geometry(const wsleds_geometry_t *geometry);
+
+/**
+ * @deprecated Shuffles pixels every call - set rotation with \c wsleds_set_geometry once instead
+ */
 void wsleds_rotate_buffer_left(const u8 times);
+
+/**
+ * Rotates 8x8 buffer 90 degrees left \c times times
+ * @deprecated Shuffles pixels every call - use \c wsleds_geometry_t rotation instead
+ */
+void wsleds_rotate_left(u32 *buffer, u8 times);
+
+void wsleds_set_brightness(u8 brightness);
+
+u8 wsleds_get_brightness();
+
+/**
+ * Builds per-channel gamma LUTs (8 bit in -> 8.8 fixed point out), 1.0 is linear - shared by all instances
+ * @warning Uses float math - call on setup, not per frame
+ */
+void wsleds_set_gamma(float r, float g, float b);
+
+/**
+ * White channel gamma for GRBW/RGBW instances (defaults to MOD_WSLEDS_GAMMA)
+ */
+void wsleds_set_gamma_white(float w);
+
+void wsleds_set_dither(bool enabled);
+
+void wsleds_set_power_limit(u32 budget_ma);
+
+wsleds_stats_t wsleds_get_stats();
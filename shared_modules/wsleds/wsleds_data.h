@@ -15,115 +15,4 @@
 #define COLOR_CYAN   	0b00000000'11111111'11111111
 #define COLOR_OFF    	0b00000000'00000000'00000000
 
-static const u32 WSLEDS_NUMBERS[10][64] = {
-	// 0:
-	{
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF
-	},
-	// 1:
-	{
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF
-	},
-	// 2:
-	{
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF
-	},
-	// 3:
-	{
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF
-	},
-	// 4:
-	{
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF
-	},
-	// 5:
-	{
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF
-	},
-	// 6:
-	{
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF
-	},
-	// 7:
-	{
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF
-	},
-	// 8:
-	{
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF
-	},
-	// 9:
-	{
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_WHITE, COLOR_WHITE, COLOR_OFF, COLOR_OFF, COLOR_OFF,
-		COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF, COLOR_OFF
-	}
-};
+// digits moved to gfx.h - GFX_FONT_DIGITS_8X8 (1 bit per pixel, draw with gfx_char in any color)
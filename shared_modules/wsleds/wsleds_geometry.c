@@ -0,0 +1,68 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "wsleds_geometry.h"
+
+static inline u32 wrap(const i32 value, const u32 size) {
+	const i32 m = value % (i32)size;
+	return (u32)(m < 0 ? m + (i32)size : m);
+}
+
+void wsleds_geometry_build(const wsleds_geometry_t *geometry, u16 *remap) {
+	const u32 w = geometry->width;
+	const u32 h = geometry->height;
+	const u32 pw = geometry->panel_width ? geometry->panel_width : w;
+	const u32 ph = geometry->panel_height ? geometry->panel_height : h;
+	const u32 tiles_x = w / pw;
+	const u32 per_panel = pw * ph;
+	const u32 logical_w = wsleds_geometry_width(geometry);
+
+	for (u32 p = 0; p < w * h; p++) {
+		// physical index -> physical (x, y)
+		const u32 tile = p / per_panel;
+		const u32 local = p % per_panel;
+		const u32 ty = tile / tiles_x;
+		u32 tx = tile % tiles_x;
+		if (geometry->tiles_serpentine && (ty & 1)) tx = tiles_x - 1 - tx;
+
+		u32 col, row;
+		if (geometry->vertical) {
+			col = local / ph;
+			row = local % ph;
+			if (geometry->serpentine && (col & 1)) row = ph - 1 - row;
+		} else {
+			row = local / pw;
+			col = local % pw;
+			if (geometry->serpentine && (row & 1)) col = pw - 1 - col;
+		}
+
+		// offset -> mirror
+		u32 x = wrap((i32)(tx * pw + col) - geometry->offset_x, w);
+		u32 y = wrap((i32)(ty * ph + row) - geometry->offset_y, h);
+		if (geometry->mirror_x) x = w - 1 - x;
+		if (geometry->mirror_y) y = h - 1 - y;
+
+		// rotation - which logical pixel lands on physical (x, y)
+		u32 lx, ly;
+		switch (geometry->rotation) {
+			case WSLEDS_ROTATE_90:
+				lx = y;
+				ly = w - 1 - x;
+				break;
+			case WSLEDS_ROTATE_180:
+				lx = w - 1 - x;
+				ly = h - 1 - y;
+				break;
+			case WSLEDS_ROTATE_270:
+				lx = h - 1 - y;
+				ly = x;
+				break;
+			default:
+				lx = x;
+				ly = y;
+				break;
+		}
+
+		remap[p] = (u16)(ly * logical_w + lx);
+	}
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "shared_config.h"
+
+/*
+ * LED matrix geometry - effects draw row major logical (x, y), wiring and orientation are baked into a
+ * physical -> logical index LUT once and applied while preparing the output, so rotation costs nothing per frame.
+ * Transform order, as seen on the physical panel: offset -> mirror -> rotation.
+ */
+
+typedef enum {
+	WSLEDS_ROTATE_0,
+	WSLEDS_ROTATE_90, // clockwise
+	WSLEDS_ROTATE_180,
+	WSLEDS_ROTATE_270,
+} wsleds_rotation_t;
+
+typedef struct {
+	u16 width; // whole physical area, multiple of panel_width
+	u16 height; // whole physical area, multiple of panel_height
+	u16 panel_width; // single tile, 0 - same as width (one panel)
+	u16 panel_height; // single tile, 0 - same as height
+	bool serpentine; // every other line inside panel runs backwards (zig-zag wiring)
+	bool vertical; // wiring runs along columns instead of rows
+	bool tiles_serpentine; // every other row of tiles runs right to left
+	wsleds_rotation_t rotation;
+	bool mirror_x;
+	bool mirror_y;
+	i16 offset_x; // content shift on the physical panel, wraps around
+	i16 offset_y;
+} wsleds_geometry_t;
+
+static inline u16 wsleds_geometry_width(const wsleds_geometry_t *geometry) {
+	return geometry->rotation & 1 ? geometry->height : geometry->width;
+}
+
+static inline u16 wsleds_geometry_height(const wsleds_geometry_t *geometry) {
+	return geometry->rotation & 1 ? geometry->width : geometry->height;
+}
+
+/**
+ * @return Logical buffer index of (x, y) - row major, logical (rotated) width
+ */
+static inline u32 wsleds_geometry_index(const wsleds_geometry_t *geometry, const u16 x, const u16 y) {
+	return (u32)y * wsleds_geometry_width(geometry) + x;
+}
+
+/**
+ * Builds physical -> logical index LUT
+ * @warning Uses division - call on setup or orientation change, not per frame
+ *
+ * @param remap \c width * \c height entries
+ */
+void wsleds_geometry_build(const wsleds_geometry_t *geometry, u16 *remap);
@@ -0,0 +1,126 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "wsleds_parallel.h"
+
+#include <hardware/dma.h>
+#include <hardware/pio.h>
+#include <pico/time.h>
+#include <pio_wsleds_parallel.pio.h>
+
+#include "utils.h"
+
+#define MAX_STRIPS 8
+#define BITS_PER_LED 24
+#define WORDS_PER_LED (BITS_PER_LED * MAX_STRIPS / 32) // 6
+#define CYCLE_NS 98
+#define CYCLES_PER_BIT 12
+#define STREAM_WORDS (MOD_WSLEDS_PARALLEL_LEDS_PER_STRIP * WORDS_PER_LED)
+
+static_assert(MOD_WSLEDS_PARALLEL_STRIPS >= 1 && MOD_WSLEDS_PARALLEL_STRIPS <= MAX_STRIPS);
+
+u32 wsleds_parallel_buffer[MOD_WSLEDS_PARALLEL_STRIPS][MOD_WSLEDS_PARALLEL_LEDS_PER_STRIP] = { };
+
+static u32 stream[2][STREAM_WORDS] = { };
+static u8 front = 0;
+static bool started = false;
+static absolute_time_t ready_at;
+
+/**
+ * 8x8 bit matrix transpose (Hacker's Delight) - rows are the 8 bytes of hi:lo (MSB byte of hi is row 0),
+ * afterwards byte N holds bit 7 - N of every row, row 0 in bit 7
+ */
+static inline void transpose8(u32 *hi, u32 *lo) {
+	u32 x = *hi;
+	u32 y = *lo;
+	u32 t;
+
+	t = (x ^ (x >> 7)) & 0x00AA00AAu;
+	x = x ^ t ^ (t << 7);
+	t = (y ^ (y >> 7)) & 0x00AA00AAu;
+	y = y ^ t ^ (t << 7);
+
+	t = (x ^ (x >> 14)) & 0x0000CCCCu;
+	x = x ^ t ^ (t << 14);
+	t = (y ^ (y >> 14)) & 0x0000CCCCu;
+	y = y ^ t ^ (t << 14);
+
+	t = (x & 0xF0F0F0F0u) | ((y >> 4) & 0x0F0F0F0Fu);
+	*lo = ((x << 4) & 0xF0F0F0F0u) | (y & 0x0F0F0F0Fu);
+	*hi = t;
+}
+
+void wsleds_parallel_transpose(u32 *stream, const u32 *const *strips, const u32 strip_count, const u32 leds_per_strip) {
+	for (u32 i = 0; i < leds_per_strip; i++) {
+		u32 c[MAX_STRIPS] = { };
+		for (u32 s = 0; s < strip_count; s++) c[s] = strips[s][i];
+
+		// R, G, B byte in wire order; rows go strip 7..0 so strip N ends up in bit N (pin base + N)
+		for (u32 shift = 16;; shift -= 8) {
+			u32 hi = ((c[7] >> shift) & 0xFF) << 24 | ((c[6] >> shift) & 0xFF) << 16 | ((c[5] >> shift) & 0xFF) << 8
+			         | ((c[4] >> shift) & 0xFF);
+			u32 lo = ((c[3] >> shift) & 0xFF) << 24 | ((c[2] >> shift) & 0xFF) << 16 | ((c[1] >> shift) & 0xFF) << 8
+			         | ((c[0] >> shift) & 0xFF);
+			transpose8(&hi, &lo);
+			*stream++ = hi; // bit periods 7..4
+			*stream++ = lo; // bit periods 3..0
+			if (shift == 0) break;
+		}
+	}
+}
+
+void wsleds_parallel_present() {
+	static const u32 *strips[MOD_WSLEDS_PARALLEL_STRIPS] = { };
+	if (unlikely(strips[0] == nullptr)) {
+		for (u32 s = 0; s < MOD_WSLEDS_PARALLEL_STRIPS; s++) strips[s] = wsleds_parallel_buffer[s];
+	}
+
+	const u8 back = front ^ 1;
+	wsleds_parallel_transpose(stream[back], strips, MOD_WSLEDS_PARALLEL_STRIPS, MOD_WSLEDS_PARALLEL_LEDS_PER_STRIP);
+
+	// DMA is paced by PIO, so previous frame end (incl. FIFO drain) is known from its start time - no IRQ needed
+	wsleds_parallel_wait_idle();
+
+	front = back;
+	started = true;
+	ready_at = make_timeout_time_us(wsleds_parallel_frame_us());
+	dma_channel_transfer_from_buffer_now(MOD_WSLEDS_PARALLEL_DMA_CH, stream[back], STREAM_WORDS);
+}
+
+void wsleds_parallel_wait_idle() {
+	if (!started) return;
+	dma_channel_wait_for_finish_blocking(MOD_WSLEDS_PARALLEL_DMA_CH);
+	busy_wait_until(ready_at);
+}
+
+u32 wsleds_parallel_frame_us() {
+	return MOD_WSLEDS_PARALLEL_LEDS_PER_STRIP * BITS_PER_LED * CYCLES_PER_BIT * CYCLE_NS / 1000 + MOD_WSLEDS_LATCH_US
+	       + 1;
+}
+
+void wsleds_parallel_init() {
+	// init DMA
+	if (dma_channel_is_claimed(MOD_WSLEDS_PARALLEL_DMA_CH)) utils_error_mode(25);
+	dma_channel_claim(MOD_WSLEDS_PARALLEL_DMA_CH);
+	dma_channel_config dma_c = dma_channel_get_default_config(MOD_WSLEDS_PARALLEL_DMA_CH);
+	channel_config_set_transfer_data_size(&dma_c, DMA_SIZE_32);
+	channel_config_set_read_increment(&dma_c, true);
+	channel_config_set_write_increment(&dma_c, false);
+	channel_config_set_dreq(&dma_c, pio_get_dreq(MOD_WSLEDS_PARALLEL_PIO, MOD_WSLEDS_PARALLEL_SM, true));
+	dma_channel_configure(MOD_WSLEDS_PARALLEL_DMA_CH, &dma_c, &MOD_WSLEDS_PARALLEL_PIO->txf[MOD_WSLEDS_PARALLEL_SM],
+	                      stream[0], STREAM_WORDS, false);
+
+	// get clock divider
+	const auto clk_div = utils_calculate_pio_clk_div_ns(CYCLE_NS);
+	utils_printf("WSLEDS PARALLEL PIO CLK DIV: %f\n", clk_div);
+
+	// init PIO
+	const auto offset = pio_add_program(MOD_WSLEDS_PARALLEL_PIO, &pio_wsleds_parallel_program);
+	if (offset < 0) utils_error_mode(26);
+	if (pio_sm_is_claimed(MOD_WSLEDS_PARALLEL_PIO, MOD_WSLEDS_PARALLEL_SM)) utils_error_mode(27);
+	pio_sm_claim(MOD_WSLEDS_PARALLEL_PIO, MOD_WSLEDS_PARALLEL_SM);
+	pio_wsleds_parallel_program_init(MOD_WSLEDS_PARALLEL_PIO, MOD_WSLEDS_PARALLEL_SM, offset,
+	                                 MOD_WSLEDS_PARALLEL_PIN_BASE, MOD_WSLEDS_PARALLEL_STRIPS, clk_div);
+	pio_sm_set_enabled(MOD_WSLEDS_PARALLEL_PIO, MOD_WSLEDS_PARALLEL_SM, true);
+	sleep_ms(1);
+}
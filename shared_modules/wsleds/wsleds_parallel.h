@@ -0,0 +1,43 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "shared_config.h"
+
+/*
+ * Parallel WS2812 output - MOD_WSLEDS_PARALLEL_STRIPS strips on consecutive pins from a single state machine.
+ * All strips shift out at the same time, so refresh time depends only on MOD_WSLEDS_PARALLEL_LEDS_PER_STRIP
+ * (8 strips of 64 refresh as fast as a single strip of 64).
+ */
+
+#define WSLEDS_PARALLEL_LED_COUNT (MOD_WSLEDS_PARALLEL_STRIPS * MOD_WSLEDS_PARALLEL_LEDS_PER_STRIP)
+
+/**
+ * Per strip pixel buffers, 0x00RRGGBB like \c wsleds_buffer
+ */
+extern u32 wsleds_parallel_buffer[MOD_WSLEDS_PARALLEL_STRIPS][MOD_WSLEDS_PARALLEL_LEDS_PER_STRIP];
+
+void wsleds_parallel_init();
+
+/**
+ * Transposes \c wsleds_parallel_buffer into the back bit-plane stream, then waits for the previous frame to be sent
+ * and latched and starts DMA. Transposing overlaps with the previous frame still streaming.
+ */
+void wsleds_parallel_present();
+
+void wsleds_parallel_wait_idle();
+
+/**
+ * @return Minimum time between frames (transfer + latch)
+ */
+u32 wsleds_parallel_frame_us();
+
+/**
+ * Bit-plane transpose kernel - for every LED index takes one color from each of 8 strips and produces 6 words
+ * (24 bit periods, MSB first, bit N of every byte is strip N). Missing strips (\c strips < 8) are sent as black.
+ *
+ * @param stream \c leds_per_strip * 6 words
+ * @param strips Per strip buffers, each \c leds_per_strip long
+ */
+void wsleds_parallel_transpose(u32 *stream, const u32 *const *strips, u32 strip_count, u32 leds_per_strip);
@@ -5,24 +5,30 @@
 
 #include <hardware/pio.h>
 
-#include "../../shared_config.h"
+#include "../wsleds/shared_config.h"
 
-#ifndef MOD_WSLEDS_LED_COUNT
-#define MOD_WSLEDS_LED_COUNT        64
+// defaults follow MOD_WSLEDS_*, so old configs keep working; set these to run both drivers at the same time
+
+#ifndef MOD_WSLEDSWHITE_LED_COUNT
+#define MOD_WSLEDSWHITE_LED_COUNT   MOD_WSLEDS_LED_COUNT
+#endif
+
+#ifndef MOD_WSLEDSWHITE_PIO
+#define MOD_WSLEDSWHITE_PIO         MOD_WSLEDS_PIO
 #endif
 
-#ifndef MOD_WSLEDS_PIO
-#define MOD_WSLEDS_PIO              pio0
+#ifndef MOD_WSLEDSWHITE_SM
+#define MOD_WSLEDSWHITE_SM          MOD_WSLEDS_SM
 #endif
 
-#ifndef MOD_WSLEDS_SM
-#define MOD_WSLEDS_SM               1
+#ifndef MOD_WSLEDSWHITE_DMA_CH
+#define MOD_WSLEDSWHITE_DMA_CH      MOD_WSLEDS_DMA_CH
 #endif
 
-#ifndef MOD_WSLEDS_DMA_CH
-#define MOD_WSLEDS_DMA_CH           1
+#ifndef MOD_WSLEDSWHITE_PIN
+#define MOD_WSLEDSWHITE_PIN         MOD_WSLEDS_PIN
 #endif
 
-#ifndef MOD_WSLEDS_PIN
-#define MOD_WSLEDS_PIN              18
+#ifndef MOD_WSLEDSWHITE_FORMAT
+#define MOD_WSLEDSWHITE_FORMAT      WSLEDS_FORMAT_GRBW
 #endif
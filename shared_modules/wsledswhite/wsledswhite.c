@@ -3,11 +3,6 @@
 
 #include "wsledswhite.h"
 
-#include <hardware/dma.h>
-#include <hardware/pio.h>
-#include <math.h>
-#include <pico/time.h>
-#include <pio_wsledswhite.pio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -16,54 +11,57 @@
 #include "wsledswhite_data.h"
 
 // for square
-// static const u8 line_width = (u8)sqrt(MOD_WSLEDS_LED_COUNT);
+// static const u8 line_width = (u8)sqrt(MOD_WSLEDSWHITE_LED_COUNT);
 
-u32 wsledswhite_buffer[MOD_WSLEDS_LED_COUNT] = { 0 };
+// thin wrapper over a wsleds instance - GRBW wiring, 102 ns cycle, PIO program shared with other wsleds instances
+
+u32 wsledswhite_buffer[MOD_WSLEDSWHITE_LED_COUNT] = { 0 };
+
+static u32 output[2][WSLEDS_OUTPUT_WORDS(MOD_WSLEDSWHITE_LED_COUNT, MOD_WSLEDSWHITE_FORMAT)] = { };
+static u32 dither[MOD_WSLEDSWHITE_LED_COUNT] = { };
+static wsleds_t leds = {
+	.count = MOD_WSLEDSWHITE_LED_COUNT,
+	.buffer = wsledswhite_buffer,
+	.output = { output[0], output[1] },
+	.dither = dither,
+	.brightness_scale = MOD_WSLEDS_BRIGHTNESS + 1,
+	.dither_enabled = MOD_WSLEDS_DITHER,
+	.power_limit_ma = MOD_WSLEDS_POWER_LIMIT_MA,
+};
+
+wsleds_t *wsledswhite_instance() {
+	return &leds;
+}
+
+void wsledswhite_present() {
+	wsleds_instance_present(&leds);
+}
 
 void wsledswhite_buffer_transfer() {
-	dma_channel_transfer_from_buffer_now(MOD_WSLEDS_DMA_CH, wsledswhite_buffer, MOD_WSLEDS_LED_COUNT);
+	wsledswhite_present();
+}
+
+bool wsledswhite_is_busy() {
+	return wsleds_instance_is_busy(&leds);
+}
+
+void wsledswhite_wait_idle() {
+	wsleds_instance_wait_idle(&leds);
 }
 
 void wsledswhite_init() {
-	// init DMA
-	if (dma_channel_is_claimed(MOD_WSLEDS_DMA_CH)) utils_error_mode(25);
-	dma_channel_claim(MOD_WSLEDS_DMA_CH);
-	dma_channel_config dma_c = dma_channel_get_default_config(MOD_WSLEDS_DMA_CH);
-	channel_config_set_transfer_data_size(&dma_c, DMA_SIZE_32);
-	channel_config_set_read_increment(&dma_c, true); // incr true - we loop through MOD_WSLEDS_LED_COUNT size buffer
-	channel_config_set_write_increment(&dma_c, false);
-	channel_config_set_dreq(&dma_c, pio_get_dreq(MOD_WSLEDS_PIO, MOD_WSLEDS_SM, true));
-	dma_channel_configure(MOD_WSLEDS_DMA_CH, &dma_c, &MOD_WSLEDS_PIO->txf[MOD_WSLEDS_SM], wsledswhite_buffer, MOD_WSLEDS_LED_COUNT,
-	                      false);
-	sleep_ms(1);
-
-	// get clock divider
-	const auto clk_div = utils_calculate_pio_clk_div_ns(102);
-	utils_printf("WSLEDS PIO CLK DIV: %f\n", clk_div);
-
-	// init PIO
-	const auto offset = pio_add_program(MOD_WSLEDS_PIO, &pio_wsledswhite_program);
-	if (offset < 0) utils_error_mode(26);
-	if (pio_sm_is_claimed(MOD_WSLEDS_PIO, MOD_WSLEDS_SM)) utils_error_mode(27);
-	pio_sm_claim(MOD_WSLEDS_PIO, MOD_WSLEDS_SM);
-	pio_wsledswhite_program_init(MOD_WSLEDS_PIO, MOD_WSLEDS_SM, offset, MOD_WSLEDS_PIN, clk_div);
-	pio_sm_set_enabled(MOD_WSLEDS_PIO, MOD_WSLEDS_SM, true);
-	sleep_ms(1);
+	leds.pio = MOD_WSLEDSWHITE_PIO;
+	leds.sm = MOD_WSLEDSWHITE_SM;
+	leds.dma_ch = MOD_WSLEDSWHITE_DMA_CH;
+	leds.pin = MOD_WSLEDSWHITE_PIN;
+	leds.format = MOD_WSLEDSWHITE_FORMAT;
+	wsleds_instance_init(&leds);
 
 	// buffer_transfer();
 }
 
 void wsledswhite_rotate_buffer_left(const u8 times) {
-	static u32 temp[MOD_WSLEDS_LED_COUNT] = { 0 };
-	if (times == 0) return;
-
-	for (auto t = 0; t < times; t++) {
-		for (auto i = 0; i < 8; i++) for (auto j = 0; j < 8; j++) temp[(7 - j) * 8 + i] = wsledswhite_buffer[i * 8 + j];
-
-		for (auto i = 0; i < MOD_WSLEDS_LED_COUNT; i++) {
-			wsledswhite_buffer[i] = temp[i];
-		}
-	}
+	wsleds_rotate_left(wsledswhite_buffer, times);
 }
 
 // static void anim_countdown() {
@@ -90,12 +88,12 @@ void wsledswhite_rotate_buffer_left(const u8 times) {
 //
 // 	if (frame % FRAME_TICKS == 0) {
 // 		if (number >= 0) {
-// 			memcpy(wsledswhite_buffer, WSLEDS_NUMBERS[number], sizeof(wsledswhite_buffer));
-// 			rotate_buffer_left(3);
+// 			memset(wsledswhite_buffer, 0, sizeof(wsledswhite_buffer));
+// 			gfx_char(&canvas, &GFX_FONT_DIGITS_8X8, 0, 0, '0' + number, COLOR_WHITE); // rotation - set geometry
 // 		}
 // 		number--;
 // 	}
-// 	for (u8 i = 0; i < MOD_WSLEDS_LED_COUNT; i++) { // why use led count config, when a lot assumes it's 8x8...
+// 	for (u8 i = 0; i < MOD_WSLEDSWHITE_LED_COUNT; i++) { // why use led count config, when a lot assumes it's 8x8...
 // 		if (wsledswhite_buffer[i] == 0) continue;
 //
 // 		u32 color = COLOR_RED;
@@ -4,11 +4,35 @@
 #pragma once
 
 #include "shared_config.h"
+#include "../wsleds/wsleds.h"
 
-extern u32 wsledswhite_buffer[MOD_WSLEDS_LED_COUNT];
+/**
+ * Logical 0xWWRRGGBB colors (see wsledswhite_data.h), sent in MOD_WSLEDSWHITE_FORMAT wire order
+ */
+extern u32 wsledswhite_buffer[MOD_WSLEDSWHITE_LED_COUNT];
 
 void wsledswhite_init();
 
+/**
+ * Same as \c wsleds_present, but for \c wsledswhite_buffer
+ */
+void wsledswhite_present();
+
+/**
+ * Same as \c wsledswhite_present
+ */
 void wsledswhite_buffer_transfer();
 
+bool wsledswhite_is_busy();
+
+void wsledswhite_wait_idle();
+
+/**
+ * @return Underlying wsleds instance - for \c wsleds_instance_set_brightness and friends
+ */
+wsleds_t *wsledswhite_instance();
+
+/**
+ * @deprecated Shuffles pixels every call - use \c wsleds_instance_set_geometry on \c wsledswhite_instance()
+ */
 void wsledswhite_rotate_buffer_left(u8 times);
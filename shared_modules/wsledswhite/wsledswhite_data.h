@@ -5,13 +5,14 @@
 
 // COLORS
 
-#define COLOR_YELLOW	0b11111111'11111111'00000000'00000000
-#define COLOR_ORANGE 	0b00011011'11111111'00000000'00000000
-#define COLOR_GREEN  	0b11111111'00000000'00000000'00000000
+// logical 0xWWRRGGBB, wire order (GRBW) is applied by wsleds
+#define COLOR_YELLOW	0b00000000'11111111'11111111'00000000
+#define COLOR_ORANGE 	0b00000000'11111111'00011011'00000000
+#define COLOR_GREEN  	0b00000000'00000000'11111111'00000000
 #define COLOR_RED    	0b00000000'11111111'00000000'00000000
-#define COLOR_WHITE  	0b00000000'00000000'00000000'11111111
+#define COLOR_WHITE  	0b11111111'00000000'00000000'00000000
 #define COLOR_WHITE_WHITE 0b11111111'11111111'11111111'11111111
-#define COLOR_BLUE   	0b00000000'00000000'11111111'00000000
-#define COLOR_PURPLE 	0b00000000'11111111'11111111'00000000
-#define COLOR_CYAN   	0b11111111'00000000'11111111'00000000
+#define COLOR_BLUE   	0b00000000'00000000'00000000'11111111
+#define COLOR_PURPLE 	0b00000000'11111111'00000000'11111111
+#define COLOR_CYAN   	0b00000000'00000000'11111111'11111111
 #define COLOR_OFF    	0b00000000'00000000'00000000'00000000
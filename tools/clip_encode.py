@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+# Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+# SPDX-License-Identifier: BSD-3-Clause
+
+"""
+Encodes PNG sequence or animated GIF into clip format (see clip.h) - delta + RLE frames, played from flash by clip_*.
+
+  clip_encode.py -o fire_clip.h --fps 30 frames/fire_*.png
+  clip_encode.py -o spinner_clip.h spinner.gif
+  clip_encode.py -o fire.bin --white frames/*.png
+
+Pixels are row major logical order (set wiring with wsleds_geometry). Output ending with .h is a C header
+(static const array, lives in flash), anything else is raw binary. Reading images needs Pillow.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+VERSION = 1
+FLAG_WHITE = 0x01
+FLAG_PALETTE = 0x02
+OP_END = 0x7F
+OP_RUN = 0x80
+OP_LITERAL = 0xC0
+MAX_SKIP = 127
+MAX_RUN = 64
+
+
+def color_bytes(color, palette, white):
+	if palette is not None:
+		return bytes([palette[color]])
+	size = 4 if white else 3
+	return (color & 0xFFFFFFFF).to_bytes(4, 'little')[:size]
+
+
+def encode_frame(prev, cur, palette, white):
+	"""Ops turning prev into cur, prev None - every pixel is written (frame 0 / loop point)"""
+	out = bytearray()
+	n = len(cur)
+	i = 0
+
+	def unchanged(j):
+		return prev is not None and cur[j] == prev[j]
+
+	while i < n:
+		if unchanged(i):
+			j = i
+			while j < n and unchanged(j):
+				j += 1
+			if j == n:
+				break  # trailing unchanged pixels need no op
+			skip = j - i
+			while skip > 0:
+				step = min(skip, MAX_SKIP)
+				out.append(step - 1)
+				skip -= step
+			i = j
+			continue
+
+		run = 1
+		while i + run < n and run < MAX_RUN and cur[i + run] == cur[i]:
+			run += 1
+		if run >= 2:
+			out.append(OP_RUN | (run - 1))
+			out += color_bytes(cur[i], palette, white)
+			i += run
+			continue
+
+		j = i + 1
+		while j < n and j - i < MAX_RUN and not unchanged(j) and not (j + 1 < n and cur[j] == cur[j + 1]):
+			j += 1
+		out.append(OP_LITERAL | (j - i - 1))
+		for k in range(i, j):
+			out += color_bytes(cur[k], palette, white)
+		i = j
+
+	out.append(OP_END)
+	return bytes(out)
+
+
+def encode(frames, frame_ms, white=False, use_palette=True):
+	"""frames - list of equally long lists of 0xWWRRGGBB colors"""
+	if not frames:
+		raise ValueError('no frames')
+	count = len(frames[0])
+	if any(len(f) != count for f in frames):
+		raise ValueError('frames differ in size')
+	if count > 0xFFFF or len(frames) > 0xFFFF or not 0 < frame_ms <= 0xFFFF:
+		raise ValueError('clip too large or bad frame time')
+
+	colors = sorted({c for f in frames for c in f})
+	palette = {c: i for i, c in enumerate(colors)} if use_palette and len(colors) <= 256 else None
+
+	flags = (FLAG_WHITE if white else 0) | (FLAG_PALETTE if palette is not None else 0)
+	out = bytearray(b'LCLP')
+	out += struct.pack('<BBHHHHH', VERSION, flags, count, len(frames), frame_ms, len(colors) if palette else 0, 0)
+	if palette is not None:
+		for c in colors:
+			out += struct.pack('<I', c)
+
+	prev = None
+	for frame in frames:
+		out += encode_frame(prev, frame, palette, white)
+		prev = frame
+	return bytes(out)
+
+
+def decode(data):
+	"""Reference decoder (mirrors clip_decode_next), yields frames"""
+	magic, version, flags, count, frame_count, frame_ms, palette_size, _ = struct.unpack_from('<4sBBHHHHH', data)
+	if magic != b'LCLP' or version != VERSION:
+		raise ValueError('not a clip')
+	palette = list(struct.unpack_from('<%dI' % palette_size, data, 16))
+	p = 16 + palette_size * 4
+	size = 1 if flags & FLAG_PALETTE else (4 if flags & FLAG_WHITE else 3)
+
+	def color(at):
+		if flags & FLAG_PALETTE:
+			return palette[data[at]]
+		return int.from_bytes(data[at:at + size], 'little')
+
+	buffer = [0] * count
+	for _ in range(frame_count):
+		pixel = 0
+		while True:
+			op = data[p]
+			p += 1
+			if op == OP_END:
+				break
+			if op < OP_END:
+				pixel += op + 1
+				continue
+			n = (op & 0x3F) + 1
+			if op < OP_LITERAL:
+				buffer[pixel:pixel + n] = [color(p)] * n
+				p += size
+			else:
+				for k in range(n):
+					buffer[pixel + k] = color(p + k * size)
+				p += n * size
+			pixel += n
+		yield list(buffer)
+
+
+def load_frames(paths, white):
+	from PIL import Image, ImageSequence
+
+	frames = []
+	durations = []
+	for path in paths:
+		image = Image.open(path)
+		for frame in ImageSequence.Iterator(image):
+			durations.append(frame.info.get('duration', 0))
+			rgba = frame.convert('RGBA')
+			size = rgba.size
+			pixels = []
+			for r, g, b, a in rgba.getdata():
+				# alpha is W channel for RGBW clips, transparent black otherwise
+				pixels.append(a << 24 | r << 16 | g << 8 | b if white else (r << 16 | g << 8 | b) * (a > 0))
+			frames.append(pixels)
+	return frames, size, durations
+
+
+def write_header(path, name, data, comment):
+	with open(path, 'w') as f:
+		f.write('// Generated by tools/clip_encode.py - %s\n\n' % comment)
+		f.write('#pragma once\n\n')
+		f.write('// const - means in .rodata, not in RAM, so basically flash storage\n')
+		f.write('static const unsigned char %s[] = {\n' % name)
+		for i in range(0, len(data), 12):
+			f.write('  ' + ', '.join('0x%02x' % b for b in data[i:i + 12]) + (',\n' if i + 12 < len(data) else '\n'))
+		f.write('};\n')
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	parser.add_argument('inputs', nargs='+', help='PNG frames (sorted by name) or animated GIF')
+	parser.add_argument('-o', '--output', required=True, help='.h for C header, otherwise raw binary')
+	parser.add_argument('--name', help='C array name (default: output file name)')
+	parser.add_argument('--fps', type=float, help='frame rate (default: GIF frame duration, else 30)')
+	parser.add_argument('--white', action='store_true', help='RGBW clip, alpha channel is W')
+	parser.add_argument('--no-palette', action='store_true', help='always store colors directly')
+	args = parser.parse_args()
+
+	paths = sorted(args.inputs) if len(args.inputs) > 1 else args.inputs
+	frames, (width, height), durations = load_frames(paths, args.white)
+	if args.fps:
+		frame_ms = round(1000 / args.fps)
+	elif durations and durations[0]:
+		frame_ms = durations[0]
+	else:
+		frame_ms = 33
+
+	data = encode(frames, frame_ms, args.white, not args.no_palette)
+	if list(decode(data)) != frames:
+		sys.exit('round trip mismatch')
+
+	raw = len(frames) * width * height * (4 if args.white else 3)
+	comment = '%dx%d, %d frames, %d ms, %d bytes (raw %d)' % (width, height, len(frames), frame_ms, len(data), raw)
+	if args.output.endswith('.h'):
+		name = args.name or re.sub(r'\W', '_', os.path.splitext(os.path.basename(args.output))[0])
+		write_header(args.output, name, data, comment)
+	else:
+		with open(args.output, 'wb') as f:
+			f.write(data)
+	print(comment)
+
+
+if __name__ == '__main__':
+	main()
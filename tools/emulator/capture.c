@@ -0,0 +1,190 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "capture.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GIF_CLEAR 256
+#define GIF_EOI 257
+#define GIF_CODES_PER_CLEAR 250 // literal only LZW, clear before dictionary outgrows 9 bit codes
+
+void capture_init(capture_t *capture, const u16 width, const u16 height) {
+	*capture = (capture_t){ .width = width, .height = height };
+}
+
+void capture_free(capture_t *capture) {
+	free(capture->rgb);
+	capture->rgb = nullptr;
+	capture->frame_count = 0;
+	capture->capacity = 0;
+}
+
+static inline size_t frame_bytes(const capture_t *capture) {
+	return (size_t)capture->width * capture->height * 3;
+}
+
+static inline u8 add_white(const u32 channel, const u32 white) {
+	const u32 sum = channel + white;
+	return (u8)(sum > 255 ? 255 : sum);
+}
+
+void capture_add_frame(capture_t *capture, const u32 *colors) {
+	if (capture->frame_count == capture->capacity) {
+		capture->capacity = capture->capacity ? capture->capacity * 2 : 16;
+		capture->rgb = realloc(capture->rgb, capture->capacity * frame_bytes(capture));
+	}
+
+	u8 *dst = capture->rgb + capture->frame_count * frame_bytes(capture);
+	for (u32 i = 0; i < (u32)capture->width * capture->height; i++) {
+		const u32 color = colors[i];
+		const u32 white = color >> 24;
+		*dst++ = add_white(color >> 16 & 0xFF, white);
+		*dst++ = add_white(color >> 8 & 0xFF, white);
+		*dst++ = add_white(color & 0xFF, white);
+	}
+	capture->frame_count++;
+}
+
+bool capture_write_ppm(const capture_t *capture, const char *path) {
+	FILE *f = fopen(path, "wb");
+	if (f == nullptr) return false;
+	fprintf(f, "P6\n%u %lu\n255\n", capture->width, (unsigned long)capture->height * capture->frame_count);
+	const size_t size = frame_bytes(capture) * capture->frame_count;
+	const bool ok = fwrite(capture->rgb, 1, size, f) == size;
+	return fclose(f) == 0 && ok;
+}
+
+bool capture_read_ppm(capture_t *capture, const char *path) {
+	FILE *f = fopen(path, "rb");
+	if (f == nullptr) return false;
+
+	unsigned width, height, max;
+	const bool header = fscanf(f, "P6 %u %u %u", &width, &height, &max) == 3 && fgetc(f) != EOF && max == 255;
+	if (!header || capture->height == 0 || height % capture->height != 0) {
+		fclose(f);
+		return false;
+	}
+
+	capture_free(capture);
+	capture->width = (u16)width;
+	capture->frame_count = height / capture->height;
+	capture->capacity = capture->frame_count;
+	const size_t size = frame_bytes(capture) * capture->frame_count;
+	capture->rgb = malloc(size);
+	const bool ok = fread(capture->rgb, 1, size, f) == size;
+	fclose(f);
+	return ok;
+}
+
+size_t capture_compare(const capture_t *a, const capture_t *b, const u8 tolerance, u32 *first_frame) {
+	if (a->width != b->width || a->height != b->height || a->frame_count != b->frame_count) return SIZE_MAX;
+
+	const size_t pixels = (size_t)a->width * a->height * a->frame_count;
+	size_t differ = 0;
+	for (size_t i = 0; i < pixels; i++) {
+		bool same = true;
+		for (u32 ch = 0; ch < 3; ch++) same &= abs(a->rgb[i * 3 + ch] - b->rgb[i * 3 + ch]) <= tolerance;
+		if (same) continue;
+		if (differ++ == 0) *first_frame = (u32)(i / ((size_t)a->width * a->height));
+	}
+	return differ;
+}
+
+// --- GIF
+
+typedef struct {
+	FILE *f;
+	u8 block[255];
+	u32 block_len;
+	u32 bits;
+	u32 bit_count;
+} gif_writer_t;
+
+static void gif_flush_block(gif_writer_t *w) {
+	if (w->block_len == 0) return;
+	fputc((int)w->block_len, w->f);
+	fwrite(w->block, 1, w->block_len, w->f);
+	w->block_len = 0;
+}
+
+static void gif_code(gif_writer_t *w, const u32 code) {
+	w->bits |= code << w->bit_count;
+	w->bit_count += 9;
+	while (w->bit_count >= 8) {
+		w->block[w->block_len++] = (u8)w->bits;
+		w->bits >>= 8;
+		w->bit_count -= 8;
+		if (w->block_len == sizeof w->block) gif_flush_block(w);
+	}
+}
+
+static inline u8 cube_index(const u8 *rgb) {
+	const u32 r = (rgb[0] * 5 + 127) / 255;
+	const u32 g = (rgb[1] * 6 + 127) / 255;
+	const u32 b = (rgb[2] * 5 + 127) / 255;
+	return (u8)(r * 42 + g * 6 + b);
+}
+
+static void put_u16(FILE *f, const u32 value) {
+	fputc(value & 0xFF, f);
+	fputc(value >> 8 & 0xFF, f);
+}
+
+bool capture_write_gif(const capture_t *capture, const char *path, const u32 scale, const u32 frame_ms) {
+	FILE *f = fopen(path, "wb");
+	if (f == nullptr) return false;
+
+	const u32 width = capture->width * scale;
+	const u32 height = capture->height * scale;
+	fwrite("GIF89a", 1, 6, f);
+	put_u16(f, width);
+	put_u16(f, height);
+	fputc(0xF7, f); // global color table, 256 entries
+	fputc(0, f);
+	fputc(0, f);
+	for (u32 i = 0; i < 256; i++) {
+		const bool used = i < 252;
+		fputc(used ? (int)(i / 42 * 255 / 5) : 0, f);
+		fputc(used ? (int)(i / 6 % 7 * 255 / 6) : 0, f);
+		fputc(used ? (int)(i % 6 * 255 / 5) : 0, f);
+	}
+	fwrite("\x21\xFF\x0BNETSCAPE2.0\x03\x01\x00\x00\x00", 1, 19, f); // loop forever
+
+	for (u32 frame = 0; frame < capture->frame_count; frame++) {
+		const u8 *rgb = capture->rgb + frame * frame_bytes(capture);
+		fwrite("\x21\xF9\x04\x00", 1, 4, f);
+		put_u16(f, (frame_ms + 5) / 10);
+		fwrite("\x00\x00", 1, 2, f);
+
+		fputc(0x2C, f);
+		put_u16(f, 0);
+		put_u16(f, 0);
+		put_u16(f, width);
+		put_u16(f, height);
+		fputc(0, f);
+		fputc(8, f); // LZW minimum code size
+
+		gif_writer_t w = { .f = f };
+		u32 codes = 0;
+		for (u32 y = 0; y < height; y++) {
+			for (u32 x = 0; x < width; x++) {
+				if (codes++ % GIF_CODES_PER_CLEAR == 0) gif_code(&w, GIF_CLEAR);
+				gif_code(&w, cube_index(&rgb[((y / scale) * capture->width + x / scale) * 3]));
+			}
+		}
+		gif_code(&w, GIF_EOI);
+		if (w.bit_count > 0) {
+			w.block[w.block_len++] = (u8)w.bits;
+			if (w.block_len == sizeof w.block) gif_flush_block(&w);
+		}
+		gif_flush_block(&w);
+		fputc(0, f);
+	}
+
+	fputc(0x3B, f);
+	return fclose(f) == 0;
+}
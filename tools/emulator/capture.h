@@ -0,0 +1,51 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <stddef.h>
+
+#include "shared_config.h"
+
+/*
+ * Captured frames as a film strip - frames stacked vertically, 8 bit RGB (W is added to RGB, saturating).
+ * Stored as binary PPM (P6), so goldens can be opened with any image viewer.
+ */
+
+typedef struct {
+	u16 width;
+	u16 height; // of one frame
+	u32 frame_count;
+	u32 capacity;
+	u8 *rgb;
+} capture_t;
+
+void capture_init(capture_t *capture, u16 width, u16 height);
+
+void capture_free(capture_t *capture);
+
+/**
+ * @param colors Logical 0xWWRRGGBB, row major \c width * \c height
+ */
+void capture_add_frame(capture_t *capture, const u32 *colors);
+
+bool capture_write_ppm(const capture_t *capture, const char *path);
+
+/**
+ * Loads film strip written by \c capture_write_ppm, frame height must already be set in \c capture
+ */
+bool capture_read_ppm(capture_t *capture, const char *path);
+
+/**
+ * Animated GIF preview (6x7x6 color cube, not exact - compare with PPM)
+ *
+ * @param scale Pixels per LED
+ */
+bool capture_write_gif(const capture_t *capture, const char *path, u32 scale, u32 frame_ms);
+
+/**
+ * @param tolerance Max allowed difference per channel
+ * @param first_frame First frame that differs (untouched when equal)
+ * @return Differing pixels, \c SIZE_MAX when sizes differ
+ */
+size_t capture_compare(const capture_t *a, const capture_t *b, u8 tolerance, u32 *first_frame);
@@ -0,0 +1,148 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "effects.h"
+
+#include "anim.h"
+#include "color.h"
+#include "compositor.h"
+#include "gfx.h"
+#include "pixels.h"
+#include "utils.h"
+#include "wsleds_data.h"
+
+static const u32 RAINBOW[] = { COLOR_RED, COLOR_ORANGE, COLOR_YELLOW, COLOR_GREEN, COLOR_CYAN, COLOR_BLUE, COLOR_PURPLE };
+
+// float path - whole buffer dims and brightens together
+static void render_pulse(u32 *buffer, const u16 width, const u16 height, const u32 frame) {
+	const u8 reduction = anim_color_reduction(PULSE, frame % 50, 50, 1.0f, 1.0f);
+	for (u32 i = 0; i < (u32)width * height; i++) {
+		buffer[i] = anim_reduce_brightness(reduction, RAINBOW[i % ARRAY_SIZE(RAINBOW)]);
+	}
+}
+
+// float blend per pixel, phase shifted by column
+static void render_blend(u32 *buffer, const u16 width, const u16 height, const u32 frame) {
+	for (u32 y = 0; y < height; y++) {
+		for (u32 x = 0; x < width; x++) {
+			buffer[y * width + x] = anim_color_blend(COLOR_RED, COLOR_BLUE, (frame * 2 + x * 4) % 64, 64, 1.0f, 1.0f);
+		}
+	}
+}
+
+// same as blend, fixed point
+static void render_blend_q16(u32 *buffer, const u16 width, const u16 height, const u32 frame) {
+	for (u32 x = 0; x < width; x++) {
+		const q16_t phase = anim_phase_q16((frame * 2 + x * 4) % 64, 64, Q16_ONE, Q16_ONE);
+		const u32 color = anim_color_blend_q16(COLOR_RED, COLOR_BLUE, phase);
+		for (u32 y = 0; y < height; y++) buffer[y * width + x] = color;
+	}
+}
+
+static const anim_keyframe_t TRACK_KEYS[] = {
+	{ .time_ms = 0, .value = COLOR_OFF, .ease = ANIM_EASE_IN_OUT },
+	{ .time_ms = 300, .value = COLOR_CYAN, .ease = ANIM_EASE_SINE },
+	{ .time_ms = 700, .value = COLOR_PURPLE, .ease = ANIM_EASE_OUT },
+	{ .time_ms = 1000, .value = COLOR_OFF, .ease = ANIM_EASE_LINEAR },
+};
+
+// keyframed color track, every row lags behind the previous one
+static void render_track(u32 *buffer, const u16 width, const u16 height, const u32 frame) {
+	static anim_track_t track;
+	if (frame == 0) anim_track_init(&track, TRACK_KEYS, ARRAY_SIZE(TRACK_KEYS), ANIM_LOOP_PING_PONG);
+
+	for (u32 y = 0; y < height; y++) {
+		const u32 color = anim_track_eval_color(&track, frame * 20 + y * 60);
+		pixels_fill(&buffer[y * width], width, color);
+	}
+}
+
+// fading trail - relies on the buffer keeping the previous frame
+static void render_comet(u32 *buffer, const u16 width, const u16 height, const u32 frame) {
+	const u32 count = (u32)width * height;
+	pixels_fade_to_black(buffer, count, 48);
+	buffer[frame * 3 % count] = COLOR_WHITE;
+	buffer[(frame * 5 + count / 2) % count] = COLOR_ORANGE;
+}
+
+// sub-pixel scroller, quarter pixel per frame
+static void render_text(u32 *buffer, const u16 width, const u16 height, const u32 frame) {
+	gfx_canvas_t canvas;
+	gfx_canvas_init(&canvas, buffer, width, height);
+	gfx_clear(&canvas, COLOR_OFF);
+	const i32 x_q8 = ((i32)width << 8) - (i32)frame * 64;
+	gfx_text_subpixel(&canvas, &GFX_FONT_5X7, x_q8, 0, "pico-shared", COLOR_GREEN);
+}
+
+// integer HSV rainbow, one circle per row, rows offset
+static void render_rainbow(u32 *buffer, const u16 width, const u16 height, const u32 frame) {
+	for (u32 y = 0; y < height; y++) {
+		color_fill_rainbow(&buffer[y * width], width, (u16)(frame * 1024 + y * 2048), 65536 / width, 255, 255);
+	}
+}
+
+static const color_gradient_stop_t LAVA[] = {
+	{ 0, COLOR_OFF }, { 96, 0x800000 }, { 160, COLOR_RED }, { 220, COLOR_ORANGE }, { 255, COLOR_YELLOW },
+};
+
+// simplex noise through a gradient palette, drifting diagonally
+static void render_plasma(u32 *buffer, const u16 width, const u16 height, const u32 frame) {
+	static color_palette_t palette;
+	if (frame == 0) color_palette_from_gradient(&palette, LAVA, ARRAY_SIZE(LAVA));
+	color_fill_noise(buffer, width, height, &palette, COLOR_NOISE_SIMPLEX, frame * 24, frame * 10, 64);
+}
+
+static void layer_rainbow(u32 *buffer, const u16 width, const u16 height, const u32 frame, const u32 param,
+                          void *user_data) {
+	(void)param;
+	(void)user_data;
+	render_rainbow(buffer, width, height, frame);
+}
+
+static void layer_comet(u32 *buffer, const u16 width, const u16 height, const u32 frame, const u32 param,
+                        void *user_data) {
+	(void)param;
+	(void)user_data;
+	render_comet(buffer, width, height, frame);
+}
+
+// UI overlay - digit posted by "core0" as layer param
+static void layer_digit(u32 *buffer, const u16 width, const u16 height, const u32 frame, const u32 param,
+                        void *user_data) {
+	(void)frame;
+	(void)user_data;
+	gfx_canvas_t canvas;
+	gfx_canvas_init(&canvas, buffer, width, height);
+	gfx_clear(&canvas, COLOR_OFF);
+	gfx_char(&canvas, &GFX_FONT_DIGITS_8X8, 0, 0, (char)('0' + param), COLOR_WHITE);
+}
+
+// compositor driven in place of core1: dimmed rainbow, comets added on top, keyed digit overlay
+static void render_layers(u32 *buffer, const u16 width, const u16 height, const u32 frame) {
+	if (frame == 0) {
+		compositor_init(nullptr, width, height);
+		compositor_set_layer(0, layer_rainbow, nullptr);
+		compositor_set_opacity(0, 96);
+		compositor_set_layer(1, layer_comet, nullptr);
+		compositor_set_blend(1, COMPOSITOR_BLEND_ADD);
+		compositor_set_layer(2, layer_digit, nullptr);
+		compositor_set_blend(2, COMPOSITOR_BLEND_KEYED);
+		compositor_set_opacity(2, 192);
+	}
+	if (frame % 8 == 0) compositor_set_param(2, frame / 8 % 10);
+	compositor_render_frame(buffer);
+}
+
+const effect_t EFFECTS[] = {
+	{ "pulse", render_pulse },
+	{ "blend", render_blend },
+	{ "blend_q16", render_blend_q16 },
+	{ "track", render_track },
+	{ "comet", render_comet },
+	{ "text", render_text },
+	{ "rainbow", render_rainbow },
+	{ "plasma", render_plasma },
+	{ "layers", render_layers },
+};
+
+const u32 EFFECT_COUNT = ARRAY_SIZE(EFFECTS);
@@ -0,0 +1,19 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "shared_config.h"
+
+/*
+ * Effects rendered by the emulator - written like app code, on top of anim/pixels/gfx.
+ * Buffer is row major width x height and keeps its contents between frames (starts black).
+ */
+
+typedef struct {
+	const char *name;
+	void (*render)(u32 *buffer, u16 width, u16 height, u32 frame);
+} effect_t;
+
+extern const effect_t EFFECTS[];
+extern const u32 EFFECT_COUNT;
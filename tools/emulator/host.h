@@ -0,0 +1,57 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <hardware/pio.h>
+
+#include "shared_config.h"
+
+/*
+ * Emulator side of the host SDK (sdk.c) - virtual time, what state machines got and how they were set up.
+ * DMA streams into a PIO TX FIFO take as long as the SM needs to shift the words out (bit cycles x clock divider),
+ * completion raises the DMA IRQ like on hardware, so latch alarms and queued frames run through the real code paths.
+ */
+
+/**
+ * Called when a DMA stream into a state machine TX FIFO completes
+ *
+ * @param words What the SM pulls from the FIFO (after DMA byte swap), in order
+ */
+typedef void (*host_tx_hook_t)(PIO pio, uint sm, const u32 *words, u32 count, void *user_data);
+
+typedef struct {
+	bool claimed;
+	bool enabled;
+	uint initial_pc;
+	pio_sm_config config;
+} host_pio_sm_t;
+
+void host_set_tx_hook(host_tx_hook_t hook, void *user_data);
+
+/**
+ * clk_sys returned by \c clock_get_hz - PIO dividers are computed from it (default 150 MHz)
+ */
+void host_set_sys_clock_hz(u32 hz);
+
+/**
+ * PIO cycles per wire bit, used to time DMA streams (default 12 - pio_wsleds 3 parts x 4 cycles)
+ */
+void host_set_pio_bit_cycles(u32 cycles);
+
+/**
+ * Moves virtual time forward, running alarms, DMA completions (IRQ handlers) and PWM wraps on the way
+ */
+void host_advance_us(u64 us);
+
+/**
+ * Runs until no DMA transfer (except endless ones) or alarm is pending
+ */
+void host_run_idle();
+
+const host_pio_sm_t *host_pio_sm(PIO pio, uint sm);
+
+/**
+ * @return Instruction memory as loaded (JMP targets relocated)
+ */
+const u16 *host_pio_memory(PIO pio);
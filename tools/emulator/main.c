@@ -0,0 +1,371 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*
+ * LED effect emulator - runs effects through the real wsleds driver on the host SDK and captures what goes on the
+ * wire (after gamma, brightness, dither and wire order), decoded back to logical colors.
+ *
+ *   led_emulator --out frames --gif            film strips (PPM) + animated previews
+ *   led_emulator --leds 64 --golden golden     visual regression check, exit code 1 on mismatch
+ *   led_emulator --leds 64 --golden golden --update
+ *   led_emulator --bench 5000                  render / present ns per frame for every effect and LED count
+ *   led_emulator --out frames --power-ma 1500  what effects look like through the current limiter (+ peak mA)
+ *
+ * LED counts are laid out as (count / 8) x 8 matrices. Times are host ns - compare runs, not boards.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "capture.h"
+#include "effects.h"
+#include "host.h"
+#include "utils.h"
+#include "wsleds.h"
+
+#define MAX_COUNTS 8
+#define MATRIX_HEIGHT 8
+
+typedef struct {
+	const char *only[16];
+	u32 only_count;
+	u32 counts[MAX_COUNTS];
+	u32 count_len;
+	wsleds_format_t format;
+	u32 frames;
+	u32 fps;
+	u8 brightness;
+	u32 power_ma;
+	bool serpentine;
+	const char *out_dir;
+	bool gif;
+	u32 scale;
+	const char *golden_dir;
+	bool update;
+	u8 tolerance;
+	u32 bench_frames;
+} options_t;
+
+typedef struct {
+	wsleds_t *leds;
+	u32 *physical; // colors as the strip got them, in wire order
+	u32 frames_received;
+} strip_t;
+
+static void on_tx(const PIO pio, const uint sm, const u32 *words, const u32 count, void *user_data) {
+	strip_t *strip = user_data;
+	const wsleds_t *leds = strip->leds;
+	if (pio != leds->pio || sm != leds->sm) return;
+
+	const u32 bytes = leds->count * leds->channels;
+	if (count * 4 < bytes) return;
+
+	// SM shifts left - MSB of every word first
+	u32 byte = 0;
+	for (u32 i = 0; i < leds->count; i++) {
+		u32 color = 0;
+		for (u32 k = 0; k < leds->channels; k++, byte++) {
+			const u32 value = words[byte / 4] >> (24 - byte % 4 * 8) & 0xFF;
+			color |= value << leds->wire_shift[k];
+		}
+		strip->physical[i] = color;
+	}
+	strip->frames_received++;
+}
+
+// built with DBG 0 - driver chatter stays quiet, warnings still show up
+void utils_printf_sink(const char *text, const size_t len) {
+	if (len >= 3 && strncmp(text, "!!!", 3) == 0) fwrite(text, 1, len, stderr);
+}
+
+static bool selected(const options_t *options, const char *name) {
+	if (options->only_count == 0) return true;
+	for (u32 i = 0; i < options->only_count; i++) {
+		if (strcmp(options->only[i], name) == 0) return true;
+	}
+	return false;
+}
+
+static u64 now_ns() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1'000'000'000 + ts.tv_nsec;
+}
+
+static wsleds_t *create_leds(const options_t *options, const u32 count) {
+	const u32 words = WSLEDS_OUTPUT_WORDS(count, options->format);
+	wsleds_t *leds = calloc(1, sizeof *leds);
+	*leds = (wsleds_t){
+		.pio = pio0,
+		.sm = 0,
+		.dma_ch = 0,
+		.pin = 0,
+		.format = options->format,
+		.count = (u16)count,
+		.buffer = calloc(count, sizeof(u32)),
+		.output = { calloc(words, sizeof(u32)), calloc(words, sizeof(u32)) },
+		.dither = calloc(count, sizeof(u32)),
+		.brightness_scale = MOD_WSLEDS_BRIGHTNESS + 1,
+		.dither_enabled = MOD_WSLEDS_DITHER,
+	};
+	wsleds_instance_init(leds);
+	wsleds_instance_set_brightness(leds, options->brightness);
+	wsleds_instance_set_power_limit(leds, options->power_ma);
+
+	if (options->serpentine) {
+		static u16 remap[UINT16_MAX];
+		const wsleds_geometry_t geometry = {
+			.width = (u16)(count / MATRIX_HEIGHT), .height = MATRIX_HEIGHT, .serpentine = true
+		};
+		wsleds_instance_set_geometry(leds, &geometry, remap);
+	}
+	return leds;
+}
+
+static void destroy_leds(wsleds_t *leds) {
+	wsleds_instance_deinit(leds);
+	free(leds->buffer);
+	free(leds->output[0]);
+	free(leds->output[1]);
+	free(leds->dither);
+	free(leds);
+}
+
+static u32 frame_period_us(const options_t *options, const wsleds_t *leds) {
+	const u32 period = 1'000'000 / options->fps;
+	const u32 min = wsleds_instance_frame_us(leds);
+	return period > min ? period : min;
+}
+
+// @return false on golden mismatch or IO error
+static bool run_capture(const options_t *options, const effect_t *effect, const u32 count) {
+	const u16 width = (u16)(count / MATRIX_HEIGHT);
+	auto leds = create_leds(options, count);
+	strip_t strip = { .leds = leds, .physical = calloc(count, sizeof(u32)) };
+	u32 *shown = calloc(count, sizeof(u32));
+	host_set_tx_hook(on_tx, &strip);
+
+	capture_t capture;
+	capture_init(&capture, width, MATRIX_HEIGHT);
+	const u32 period_us = frame_period_us(options, leds);
+	u32 peak_ma = 0;
+	u32 peak_sent_ma = 0;
+	for (u32 frame = 0; frame < options->frames; frame++) {
+		effect->render(leds->buffer, width, MATRIX_HEIGHT, frame);
+		wsleds_instance_present(leds);
+		host_advance_us(period_us);
+
+		const auto stats = wsleds_instance_get_stats(leds);
+		if (stats.frame_ma > peak_ma) peak_ma = stats.frame_ma;
+		if (stats.sent_ma > peak_sent_ma) peak_sent_ma = stats.sent_ma;
+
+		// back to logical (x, y) positions, unchanged frames keep what the strip still shows
+		for (u32 i = 0; i < count; i++) shown[leds->remap != nullptr ? leds->remap[i] : i] = strip.physical[i];
+		capture_add_frame(&capture, shown);
+	}
+
+	char name[128];
+	char path[512];
+	snprintf(name, sizeof name, "%s_%lu", effect->name, (unsigned long)count);
+	bool ok = true;
+
+	if (options->power_ma != 0) {
+		printf("%-16s peak %lu mA, sent %lu mA, %lu frames limited\n", name, (unsigned long)peak_ma,
+		       (unsigned long)peak_sent_ma, (unsigned long)wsleds_instance_get_stats(leds).limited);
+	}
+
+	if (options->out_dir != nullptr) {
+		snprintf(path, sizeof path, "%s/%s.ppm", options->out_dir, name);
+		ok &= capture_write_ppm(&capture, path);
+		if (options->gif) {
+			snprintf(path, sizeof path, "%s/%s.gif", options->out_dir, name);
+			ok &= capture_write_gif(&capture, path, options->scale, period_us / 1000);
+		}
+		if (!ok) printf("!!! %s: can't write to %s\n", name, options->out_dir);
+	}
+
+	if (options->golden_dir != nullptr) {
+		snprintf(path, sizeof path, "%s/%s.ppm", options->golden_dir, name);
+		if (options->update) {
+			ok &= capture_write_ppm(&capture, path);
+			printf("%-16s golden written\n", name);
+		} else {
+			capture_t golden;
+			capture_init(&golden, width, MATRIX_HEIGHT);
+			u32 first_frame = 0;
+			if (!capture_read_ppm(&golden, path)) {
+				printf("%-16s FAIL - no golden %s\n", name, path);
+				ok = false;
+			} else {
+				const auto differ = capture_compare(&capture, &golden, options->tolerance, &first_frame);
+				if (differ == SIZE_MAX) printf("%-16s FAIL - golden size differs\n", name);
+				else if (differ > 0) {
+					printf("%-16s FAIL - %zu pixels differ, first in frame %lu\n", name, differ,
+					       (unsigned long)first_frame);
+				} else printf("%-16s ok\n", name);
+				ok &= differ == 0;
+			}
+			capture_free(&golden);
+		}
+	}
+
+	capture_free(&capture);
+	host_set_tx_hook(nullptr, nullptr);
+	free(shown);
+	free(strip.physical);
+	destroy_leds(leds);
+	return ok;
+}
+
+static void run_bench(const options_t *options, const effect_t *effect, const u32 count) {
+	const u16 width = (u16)(count / MATRIX_HEIGHT);
+	auto leds = create_leds(options, count);
+	wsleds_instance_set_skip_unchanged(leds, false, 0); // every present prepares a frame
+	const u32 period_us = frame_period_us(options, leds);
+
+	u64 render_ns = 0;
+	u64 present_ns = 0;
+	for (u32 frame = 0; frame < options->bench_frames; frame++) {
+		const u64 t0 = now_ns();
+		effect->render(leds->buffer, width, MATRIX_HEIGHT, frame);
+		const u64 t1 = now_ns();
+		wsleds_instance_present(leds);
+		const u64 t2 = now_ns();
+		host_advance_us(period_us); // DMA, IRQ and latch - not timed
+		render_ns += t1 - t0;
+		present_ns += t2 - t1;
+	}
+
+	printf("%-12s %6lu %12.0f %12.0f %10.1f\n", effect->name, (unsigned long)count,
+	       (double)render_ns / options->bench_frames, (double)present_ns / options->bench_frames,
+	       (double)(render_ns + present_ns) / options->bench_frames / count);
+	destroy_leds(leds);
+}
+
+static bool parse_format(const char *text, wsleds_format_t *format) {
+	static const char *NAMES[] = { [WSLEDS_FORMAT_RGB] = "rgb", [WSLEDS_FORMAT_GRB] = "grb",
+	                               [WSLEDS_FORMAT_GRBW] = "grbw", [WSLEDS_FORMAT_RGBW] = "rgbw" };
+	for (u32 i = 0; i < ARRAY_SIZE(NAMES); i++) {
+		if (strcmp(text, NAMES[i]) == 0) {
+			*format = (wsleds_format_t)i;
+			return true;
+		}
+	}
+	return false;
+}
+
+static void usage() {
+	printf("usage: led_emulator [options]\n"
+	       "  --effect NAME       only this effect (repeatable), default all:");
+	for (u32 i = 0; i < EFFECT_COUNT; i++) printf(" %s", EFFECTS[i].name);
+	printf("\n"
+	       "  --leds N[,N...]     LED counts, multiples of 8 (default 64,256,1024)\n"
+	       "  --format FORMAT     rgb, grb, grbw, rgbw (default grb)\n"
+	       "  --frames N          captured frames (default 32)\n"
+	       "  --fps N             present rate (default 50, capped by what the strip can do)\n"
+	       "  --brightness N      0..255 (default 255)\n"
+	       "  --power-ma N        current limit for the strip (default 0 - off)\n"
+	       "  --serpentine        wire as serpentine matrix (geometry LUT)\n"
+	       "  --sys-mhz N         clk_sys for PIO dividers (default 150)\n"
+	       "  --out DIR           write EFFECT_LEDS.ppm film strips (frames stacked)\n"
+	       "  --gif               also write EFFECT_LEDS.gif previews to --out\n"
+	       "  --scale N           GIF pixels per LED (default 16)\n"
+	       "  --golden DIR        compare with DIR/EFFECT_LEDS.ppm, exit 1 on mismatch\n"
+	       "  --update            write goldens instead of comparing\n"
+	       "  --tolerance N       allowed difference per channel (default 0)\n"
+	       "  --bench N           time N frames per effect and LED count (default 0 - off)\n");
+}
+
+int main(const int argc, char **argv) {
+	options_t options = {
+		.counts = { 64, 256, 1024 },
+		.count_len = 3,
+		.format = WSLEDS_FORMAT_GRB,
+		.frames = 32,
+		.fps = 50,
+		.brightness = 255,
+		.scale = 16,
+	};
+
+	for (i32 i = 1; i < argc; i++) {
+		const char *arg = argv[i];
+		const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+		const bool has_value = value != nullptr;
+
+		if (strcmp(arg, "--effect") == 0 && has_value && options.only_count < ARRAY_SIZE(options.only)) {
+			options.only[options.only_count++] = value;
+		} else if (strcmp(arg, "--leds") == 0 && has_value) {
+			options.count_len = 0;
+			for (char *end = (char *)value; *end && options.count_len < MAX_COUNTS; end += *end == ',') {
+				options.counts[options.count_len++] = strtoul(end, &end, 10);
+			}
+		} else if (strcmp(arg, "--format") == 0 && has_value) {
+			if (!parse_format(value, &options.format)) {
+				usage();
+				return 2;
+			}
+		} else if (strcmp(arg, "--frames") == 0 && has_value) options.frames = strtoul(value, nullptr, 10);
+		else if (strcmp(arg, "--fps") == 0 && has_value) options.fps = strtoul(value, nullptr, 10);
+		else if (strcmp(arg, "--brightness") == 0 && has_value) options.brightness = (u8)strtoul(value, nullptr, 10);
+		else if (strcmp(arg, "--power-ma") == 0 && has_value) options.power_ma = strtoul(value, nullptr, 10);
+		else if (strcmp(arg, "--sys-mhz") == 0 && has_value) host_set_sys_clock_hz(strtoul(value, nullptr, 10) * 1'000'000);
+		else if (strcmp(arg, "--out") == 0 && has_value) options.out_dir = value;
+		else if (strcmp(arg, "--scale") == 0 && has_value) options.scale = strtoul(value, nullptr, 10);
+		else if (strcmp(arg, "--golden") == 0 && has_value) options.golden_dir = value;
+		else if (strcmp(arg, "--tolerance") == 0 && has_value) options.tolerance = (u8)strtoul(value, nullptr, 10);
+		else if (strcmp(arg, "--bench") == 0 && has_value) options.bench_frames = strtoul(value, nullptr, 10);
+		else if (strcmp(arg, "--serpentine") == 0) {
+			options.serpentine = true;
+			continue;
+		} else if (strcmp(arg, "--gif") == 0) {
+			options.gif = true;
+			continue;
+		} else if (strcmp(arg, "--update") == 0) {
+			options.update = true;
+			continue;
+		} else {
+			usage();
+			return 2;
+		}
+		i++; // value consumed
+	}
+
+	for (u32 c = 0; c < options.count_len; c++) {
+		const u32 count = options.counts[c];
+		if (count == 0 || count % MATRIX_HEIGHT != 0 || count > UINT16_MAX || options.fps == 0 || options.scale == 0) {
+			usage();
+			return 2;
+		}
+	}
+
+	if (options.out_dir != nullptr && mkdir(options.out_dir, 0755) != 0 && errno != EEXIST) {
+		printf("!!! can't create %s\n", options.out_dir);
+		return 1;
+	}
+	if (options.update && options.golden_dir != nullptr && mkdir(options.golden_dir, 0755) != 0 && errno != EEXIST) {
+		printf("!!! can't create %s\n", options.golden_dir);
+		return 1;
+	}
+
+	bool ok = true;
+	if (options.out_dir != nullptr || options.golden_dir != nullptr) {
+		for (u32 e = 0; e < EFFECT_COUNT; e++) {
+			if (!selected(&options, EFFECTS[e].name)) continue;
+			for (u32 c = 0; c < options.count_len; c++) ok &= run_capture(&options, &EFFECTS[e], options.counts[c]);
+		}
+	}
+
+	if (options.bench_frames > 0) {
+		printf("%-12s %6s %12s %12s %10s\n", "effect", "leds", "render ns", "present ns", "ns/led");
+		for (u32 e = 0; e < EFFECT_COUNT; e++) {
+			if (!selected(&options, EFFECTS[e].name)) continue;
+			for (u32 c = 0; c < options.count_len; c++) run_bench(&options, &EFFECTS[e], options.counts[c]);
+		}
+	}
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,247 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "pio_emu.h"
+
+enum { OP_JMP, OP_WAIT, OP_IN, OP_OUT, OP_PUSH_PULL, OP_MOV, OP_IRQ, OP_SET };
+
+void pio_emu_init(pio_emu_t *emu, const u16 *memory, const pio_sm_config *config, const uint initial_pc) {
+	*emu = (pio_emu_t){
+		.memory = memory,
+		.config = *config,
+		.pc = initial_pc,
+		.osr_count = 32, // empty - first OUT autopulls
+	};
+}
+
+void pio_emu_set_tx(pio_emu_t *emu, const u32 *words, const u32 count) {
+	emu->tx = words;
+	emu->tx_count = count;
+	emu->tx_pulled = 0;
+}
+
+u64 pio_emu_sys_cycle(const pio_emu_t *emu, const u64 cycle) {
+	// same truncation as the SDK: 16 bit integer, 8 bit fraction
+	const float div = emu->config.clkdiv;
+	const u32 integer = (u32)div;
+	const u32 frac = integer == 0 ? 0 : (u32)((div - (float)integer) * 256.0f);
+	const u64 div_fx = integer == 0 ? 65536u * 256 : (u64)integer << 8 | frac;
+	return cycle * div_fx >> 8;
+}
+
+static inline u32 pull_threshold(const pio_emu_t *emu) {
+	return emu->config.pull_threshold == 0 ? 32 : emu->config.pull_threshold;
+}
+
+static inline bool tx_empty(const pio_emu_t *emu) {
+	return emu->tx_pulled >= emu->tx_count;
+}
+
+static inline void pull(pio_emu_t *emu) {
+	emu->osr = emu->tx[emu->tx_pulled++];
+	emu->osr_count = 0;
+}
+
+static void write_pins(u32 *pins, const u32 base, const u32 count, const u32 value) {
+	for (u32 i = 0; i < count; i++) {
+		const u32 pin = (base + i) % 32;
+		*pins = (*pins & ~(1u << pin)) | ((value >> i & 1) << pin);
+	}
+}
+
+static u32 shift_out(pio_emu_t *emu, const u32 bits) {
+	u32 data;
+	if (emu->config.out_shift_right) {
+		data = bits == 32 ? emu->osr : emu->osr & ((1u << bits) - 1);
+		emu->osr = bits == 32 ? 0 : emu->osr >> bits;
+	} else {
+		data = bits == 32 ? emu->osr : emu->osr >> (32 - bits);
+		emu->osr = bits == 32 ? 0 : emu->osr << bits;
+	}
+	emu->osr_count = emu->osr_count + bits > 32 ? 32 : emu->osr_count + bits;
+	return data;
+}
+
+static void shift_in(pio_emu_t *emu, const u32 data, const u32 bits) {
+	const u32 masked = bits == 32 ? data : data & ((1u << bits) - 1);
+	if (emu->config.in_shift_right) emu->isr = bits == 32 ? masked : emu->isr >> bits | masked << (32 - bits);
+	else emu->isr = bits == 32 ? masked : emu->isr << bits | masked;
+	emu->isr_count = emu->isr_count + bits > 32 ? 32 : emu->isr_count + bits;
+}
+
+static u32 mov_source(const pio_emu_t *emu, const u32 source) {
+	switch (source) {
+		case 0: return emu->pins;
+		case 1: return emu->x;
+		case 2: return emu->y;
+		case 3: return 0;
+		case 5: return tx_empty(emu) ? 0xFFFFFFFFu : 0; // STATUS - default: all ones when TX FIFO is empty
+		case 6: return emu->isr;
+		case 7: return emu->osr;
+		default: return 0;
+	}
+}
+
+// @return true when instruction completed (false - stalled or error)
+static bool execute(pio_emu_t *emu, const u16 instr, bool *jumped) {
+	const u32 op = instr >> 13;
+	const u32 arg1 = instr >> 5 & 0x7;
+	const u32 arg2 = instr & 0x1F;
+	const u32 bits = arg2 == 0 ? 32 : arg2;
+
+	switch (op) {
+		case OP_JMP: {
+			bool take;
+			switch (arg1) {
+				case 0: take = true; break;
+				case 1: take = emu->x == 0; break;
+				case 2: take = emu->x-- != 0; break;
+				case 3: take = emu->y == 0; break;
+				case 4: take = emu->y-- != 0; break;
+				case 5: take = emu->x != emu->y; break;
+				case 6: take = emu->pins >> emu->config.jmp_pin & 1; break;
+				default: take = emu->osr_count < pull_threshold(emu); break; // !OSRE
+			}
+			if (take) {
+				emu->pc = arg2;
+				*jumped = true;
+			}
+			return true;
+		}
+		case OP_OUT: {
+			if (emu->config.autopull && emu->osr_count >= pull_threshold(emu)) {
+				if (tx_empty(emu)) return false; // stalls until DMA refills
+				pull(emu);
+			}
+			const u32 data = shift_out(emu, bits);
+			switch (arg1) {
+				case 0: {
+					const u32 count = emu->config.out_count < bits ? emu->config.out_count : bits;
+					write_pins(&emu->pins, emu->config.out_base, count, data);
+					break;
+				}
+				case 1: emu->x = data; break;
+				case 2: emu->y = data; break;
+				case 3: break;
+				case 4: write_pins(&emu->pindirs, emu->config.out_base, bits, data); break;
+				case 5:
+					emu->pc = data & 0x1F;
+					*jumped = true;
+					break;
+				case 6:
+					emu->isr = data;
+					emu->isr_count = bits;
+					break;
+				default:
+					emu->error = "OUT EXEC not supported";
+					return false;
+			}
+			return true;
+		}
+		case OP_PUSH_PULL: {
+			if (!(instr & 0x80)) {
+				emu->error = "PUSH not supported";
+				return false;
+			}
+			const bool if_empty = instr & 0x40;
+			const bool block = instr & 0x20;
+			if (if_empty && emu->osr_count < pull_threshold(emu)) return true;
+			if (tx_empty(emu)) {
+				if (block) return false;
+				emu->osr = emu->x; // non blocking pull of empty FIFO copies X
+				emu->osr_count = 0;
+				return true;
+			}
+			pull(emu);
+			return true;
+		}
+		case OP_MOV: {
+			const u32 mov_op = instr >> 3 & 0x3;
+			u32 data = mov_source(emu, instr & 0x7);
+			if (mov_op == 1) data = ~data;
+			else if (mov_op == 2) {
+				u32 reversed = 0;
+				for (u32 i = 0; i < 32; i++) reversed |= (data >> i & 1) << (31 - i);
+				data = reversed;
+			}
+			switch (arg1) {
+				case 0: write_pins(&emu->pins, emu->config.out_base, emu->config.out_count, data); break;
+				case 1: emu->x = data; break;
+				case 2: emu->y = data; break;
+				case 5:
+					emu->pc = data & 0x1F;
+					*jumped = true;
+					break;
+				case 6:
+					emu->isr = data;
+					emu->isr_count = 0;
+					break;
+				case 7:
+					emu->osr = data;
+					emu->osr_count = 0;
+					break;
+				default:
+					emu->error = "MOV destination not supported";
+					return false;
+			}
+			return true;
+		}
+		case OP_SET: {
+			switch (arg1) {
+				case 0: write_pins(&emu->pins, emu->config.set_base, emu->config.set_count, arg2); break;
+				case 1: emu->x = arg2; break;
+				case 2: emu->y = arg2; break;
+				case 4: write_pins(&emu->pindirs, emu->config.set_base, emu->config.set_count, arg2); break;
+				default:
+					emu->error = "SET destination not supported";
+					return false;
+			}
+			return true;
+		}
+		case OP_IN: {
+			const u32 source = arg1 == 0 ? emu->pins : mov_source(emu, arg1);
+			shift_in(emu, source, bits);
+			return true;
+		}
+		default:
+			emu->error = op == OP_WAIT ? "WAIT not supported" : "IRQ not supported";
+			return false;
+	}
+}
+
+bool pio_emu_step(pio_emu_t *emu) {
+	if (emu->error != nullptr) return false;
+	emu->cycle++;
+	if (emu->delay > 0) {
+		emu->delay--;
+		return true;
+	}
+
+	const u16 instr = emu->memory[emu->pc];
+	const u32 delay_side = instr >> 8 & 0x1F;
+	const u32 side_bits = emu->config.sideset_bits;
+	const u32 delay_bits = 5 - side_bits;
+	const u32 delay = delay_side & ((1u << delay_bits) - 1);
+
+	// side-set is asserted on the first cycle, even when the instruction stalls
+	if (side_bits > 0) {
+		const u32 side = delay_side >> delay_bits;
+		const u32 value_bits = emu->config.sideset_optional ? side_bits - 1 : side_bits;
+		const bool enabled = !emu->config.sideset_optional || side >> value_bits & 1;
+		if (enabled) {
+			u32 *target = emu->config.sideset_pindirs ? &emu->pindirs : &emu->pins;
+			write_pins(target, emu->config.sideset_base, value_bits, side);
+		}
+	}
+
+	bool jumped = false;
+	emu->stalled = !execute(emu, instr, &jumped);
+	if (emu->error != nullptr) return false;
+	if (emu->stalled) return true;
+
+	if (!jumped) {
+		emu->pc = emu->pc == emu->config.wrap ? emu->config.wrap_target : (emu->pc + 1) % PIO_INSTRUCTION_COUNT;
+	}
+	emu->delay = delay;
+	return true;
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <hardware/pio.h>
+
+#include "shared_config.h"
+
+/*
+ * Cycle accurate model of one PIO state machine - runs instruction memory and SM config as the driver loaded them
+ * (host_pio_memory / host_pio_sm). Supported: JMP (all conditions), OUT, PULL, MOV, SET, IN, side-set, delays,
+ * autopull, wrap. WAIT, IRQ, PUSH and EXEC destinations stop the emulation with an error.
+ * TX FIFO is fed from a word array, as if DMA kept it full until the array runs out.
+ */
+
+typedef struct {
+	const u16 *memory;
+	pio_sm_config config;
+
+	u32 pc;
+	u32 x;
+	u32 y;
+	u32 osr;
+	u32 osr_count; // bits shifted out since last pull, >= threshold - empty
+	u32 isr;
+	u32 isr_count;
+	u32 pins;
+	u32 pindirs;
+	u32 delay; // cycles left
+	bool stalled;
+	u64 cycle; // cycles run so far - index of the next one
+
+	const u32 *tx;
+	u32 tx_count;
+	u32 tx_pulled; // words moved from FIFO to OSR
+
+	const char *error;
+} pio_emu_t;
+
+void pio_emu_init(pio_emu_t *emu, const u16 *memory, const pio_sm_config *config, uint initial_pc);
+
+/**
+ * @param words What DMA pushes into TX FIFO (after byte swap), must stay valid while running
+ */
+void pio_emu_set_tx(pio_emu_t *emu, const u32 *words, u32 count);
+
+/**
+ * Runs one SM clock cycle
+ *
+ * @return \c false on unsupported instruction (\c emu->error says which)
+ */
+bool pio_emu_step(pio_emu_t *emu);
+
+/**
+ * @return System clock cycle at which SM cycle \c cycle starts - divider quantized to 16.8 like the hardware,
+ * fractional dividers spread SM cycles over floor/ceil system cycles
+ */
+u64 pio_emu_sys_cycle(const pio_emu_t *emu, u64 cycle);
@@ -0,0 +1,262 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*
+ * WS LED bit timing check - sets up every pixel format through the real wsleds driver at each system clock (so the
+ * divider comes from utils_calculate_pio_clk_div_ns like on the board), runs the loaded pio_wsleds program cycle by
+ * cycle on a test pattern and measures the pin waveform:
+ * - every high/low time is inside the WS2812 windows (pio_wsleds.pio timing comment)
+ * - decoded bits match the bytes DMA sent
+ * - line is low for MOD_WSLEDS_LATCH_US before the driver lets the next frame start (drain_latch_us estimate)
+ *
+ *   pio_timing                                 all formats at 48, 125, 150, 200 and 250 MHz
+ *   pio_timing --sys-mhz 300 --cycle-ns 90     try a tighter cycle than the driver uses before changing it
+ *   pio_timing --vcd waves                     pin waveforms for GTKWave & co.
+ *
+ * Exit code 1 when anything is out of window.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "host.h"
+#include "pio_emu.h"
+#include "utils.h"
+#include "wsleds.h"
+
+#define TEST_LEDS 25 // more words than FIFO holds, RGB stream ends mid word - padding bits get checked too
+#define MAX_CLOCKS 8
+#define MAX_WORDS WSLEDS_OUTPUT_WORDS(TEST_LEDS, WSLEDS_FORMAT_GRBW)
+#define MAX_BITS (MAX_WORDS * 32)
+#define PIO_TX_FIFO_DEPTH 8
+#define IDLE_CYCLES 64 // stalled this long after the last word - frame is over
+
+typedef struct {
+	u32 t0h_min, t0h_max;
+	u32 t0l_min, t0l_max;
+	u32 t1h_min, t1h_max;
+	u32 t1l_min, t1l_max;
+} window_t;
+
+// pio_wsleds.pio: 0 - 250-550 ns high, 700-1000 ns low; 1 - 650-950 ns high, 300-600 ns low
+static constexpr window_t WS2812 = { 250, 550, 700, 1000, 650, 950, 300, 600 };
+
+static const u32 PATTERN[] = {
+	0x00000000, 0xFFFFFFFF, 0x55AA55AA, 0xAA55AA55, 0x0F0F0F0F, 0xF0F0F0F0, 0x813C7E18, 0x01800180, 0xFF00FF00,
+};
+
+static const char *FORMAT_NAMES[] = {
+	[WSLEDS_FORMAT_RGB] = "RGB", [WSLEDS_FORMAT_GRB] = "GRB", [WSLEDS_FORMAT_GRBW] = "GRBW", [WSLEDS_FORMAT_RGBW] = "RGBW"
+};
+
+typedef struct {
+	u32 words[MAX_WORDS];
+	u32 count;
+} stream_t;
+
+typedef struct {
+	u64 rise_ns;
+	u64 fall_ns;
+} pulse_t;
+
+typedef struct {
+	u32 min;
+	u32 max;
+} range_t;
+
+static void on_tx(const PIO pio, const uint sm, const u32 *words, const u32 count, void *user_data) {
+	(void)pio;
+	(void)sm;
+	stream_t *stream = user_data;
+	stream->count = count < MAX_WORDS ? count : MAX_WORDS;
+	memcpy(stream->words, words, stream->count * sizeof(u32));
+}
+
+static inline void widen(range_t *range, const u32 value) {
+	if (value < range->min) range->min = value;
+	if (value > range->max) range->max = value;
+}
+
+static inline bool inside(const range_t *range, const u32 min, const u32 max) {
+	return range->min == UINT32_MAX || (range->min >= min && range->max <= max);
+}
+
+static void print_range(const range_t *range) {
+	if (range->min == UINT32_MAX) printf("   %9s", "-");
+	else printf("   %4lu-%-4lu", (unsigned long)range->min, (unsigned long)range->max);
+}
+
+static void write_vcd(const char *dir, const char *name, const pulse_t *pulses, const u32 count, const u64 end_ns) {
+	char path[512];
+	snprintf(path, sizeof path, "%s/%s.vcd", dir, name);
+	FILE *f = fopen(path, "w");
+	if (f == nullptr) {
+		printf("!!! can't write %s\n", path);
+		return;
+	}
+	fprintf(f, "$timescale 1ns $end\n$scope module wsleds $end\n$var wire 1 ! dout $end\n$upscope $end\n"
+	           "$enddefinitions $end\n#0\n0!\n");
+	for (u32 i = 0; i < count; i++) {
+		fprintf(f, "#%llu\n1!\n#%llu\n0!\n", (unsigned long long)pulses[i].rise_ns,
+		        (unsigned long long)pulses[i].fall_ns);
+	}
+	fprintf(f, "#%llu\n", (unsigned long long)end_ns);
+	fclose(f);
+}
+
+// @return true when every window holds
+static bool check(const u32 sys_hz, const wsleds_format_t format, const u32 cycle_ns_override, const char *vcd_dir) {
+	host_set_sys_clock_hz(sys_hz);
+
+	static u32 buffer[TEST_LEDS];
+	static u32 output[2][MAX_WORDS];
+	wsleds_t leds = {
+		.pio = pio0,
+		.sm = 0,
+		.dma_ch = 0,
+		.format = format,
+		.count = TEST_LEDS,
+		.buffer = buffer,
+		.output = { output[0], output[1] },
+		.brightness_scale = 256,
+	};
+	for (u32 i = 0; i < TEST_LEDS; i++) buffer[i] = PATTERN[i % ARRAY_SIZE(PATTERN)];
+
+	stream_t stream = { };
+	host_set_tx_hook(on_tx, &stream);
+	wsleds_instance_init(&leds);
+	wsleds_instance_present(&leds);
+	host_run_idle();
+	host_set_tx_hook(nullptr, nullptr);
+
+	const auto sm = host_pio_sm(leds.pio, leds.sm);
+	pio_sm_config config = sm->config;
+	if (cycle_ns_override != 0) config.clkdiv = utils_calculate_pio_clk_div_ns((float)cycle_ns_override);
+	pio_emu_t emu;
+	pio_emu_init(&emu, host_pio_memory(leds.pio), &config, sm->initial_pc);
+	pio_emu_set_tx(&emu, stream.words, stream.count);
+	const u32 drain_latch_us = leds.drain_latch_us;
+	const u32 frame_us = wsleds_instance_frame_us(&leds);
+	wsleds_instance_deinit(&leds);
+
+	// run until FIFO is dry and the SM sat stalled for a while, record side-set pin edges
+	const u32 pin = config.sideset_base;
+	pulse_t pulses[MAX_BITS];
+	u32 pulse_count = 0;
+	bool level = false;
+	u64 idle = 0;
+	u64 dma_done_cycle = 0;
+	const u32 dma_done_pulls = stream.count > PIO_TX_FIFO_DEPTH ? stream.count - PIO_TX_FIFO_DEPTH : 0;
+
+	while (idle < IDLE_CYCLES && pulse_count < MAX_BITS) {
+		const u64 cycle = emu.cycle;
+		const u32 pulled = emu.tx_pulled;
+		if (!pio_emu_step(&emu)) {
+			printf("!!! PIO emulation stopped: %s\n", emu.error);
+			return false;
+		}
+		if (pulled < dma_done_pulls && emu.tx_pulled == dma_done_pulls) dma_done_cycle = cycle; // last word in FIFO
+
+		const bool high = emu.pins >> pin & 1;
+		if (high != level) {
+			const u64 ns = pio_emu_sys_cycle(&emu, cycle) * 1'000'000'000 / sys_hz;
+			if (high) pulses[pulse_count].rise_ns = ns;
+			else pulses[pulse_count++].fall_ns = ns;
+			level = high;
+		}
+		idle = emu.stalled && emu.tx_pulled == emu.tx_count ? idle + 1 : 0;
+	}
+
+	// bits as sent - MSB first from every word
+	range_t t0h = { UINT32_MAX, 0 }, t0l = { UINT32_MAX, 0 }, t1h = { UINT32_MAX, 0 }, t1l = { UINT32_MAX, 0 };
+	const u32 expected_bits = stream.count * 32;
+	bool bits_ok = pulse_count == expected_bits;
+	const u32 threshold_ns = (WS2812.t0h_max + WS2812.t1h_min) / 2;
+	for (u32 i = 0; i < pulse_count && i < expected_bits; i++) {
+		const bool bit = stream.words[i / 32] >> (31 - i % 32) & 1;
+		const u32 high_ns = (u32)(pulses[i].fall_ns - pulses[i].rise_ns);
+		bits_ok &= (high_ns > threshold_ns) == bit;
+		widen(bit ? &t1h : &t0h, high_ns);
+		if (i + 1 < pulse_count) widen(bit ? &t1l : &t0l, (u32)(pulses[i + 1].rise_ns - pulses[i].fall_ns));
+	}
+
+	// driver frees the line drain_latch_us after DMA completion, the line must have been low for the latch by then
+	const u64 last_fall_ns = pulse_count > 0 ? pulses[pulse_count - 1].fall_ns : 0;
+	const u64 dma_done_ns = pio_emu_sys_cycle(&emu, dma_done_cycle) * 1'000'000'000 / sys_hz;
+	const i64 latch_margin_ns = (i64)(dma_done_ns + drain_latch_us * 1000ull)
+	                            - (i64)(last_fall_ns + MOD_WSLEDS_LATCH_US * 1000ull);
+
+	const bool windows_ok = inside(&t0h, WS2812.t0h_min, WS2812.t0h_max)
+	                        && inside(&t0l, WS2812.t0l_min, WS2812.t0l_max)
+	                        && inside(&t1h, WS2812.t1h_min, WS2812.t1h_max)
+	                        && inside(&t1l, WS2812.t1l_min, WS2812.t1l_max);
+	const bool ok = windows_ok && bits_ok && latch_margin_ns >= 0;
+	const u32 bit_ns = pulse_count > 1 ? (u32)((pulses[pulse_count - 1].rise_ns - pulses[0].rise_ns) / (pulse_count - 1)) : 0;
+
+	printf("%5lu  %-5s %8.3f", (unsigned long)(sys_hz / 1'000'000), FORMAT_NAMES[format], (double)config.clkdiv);
+	print_range(&t0h);
+	print_range(&t0l);
+	print_range(&t1h);
+	print_range(&t1l);
+	printf("   %6lu %8lu %9.1f   %s%s\n", (unsigned long)bit_ns, (unsigned long)frame_us,
+	       (double)latch_margin_ns / 1000.0, ok ? "ok" : "FAIL", bits_ok ? "" : " (bits)");
+
+	if (vcd_dir != nullptr) {
+		char name[64];
+		snprintf(name, sizeof name, "wsleds_%s_%lumhz", FORMAT_NAMES[format], (unsigned long)(sys_hz / 1'000'000));
+		write_vcd(vcd_dir, name, pulses, pulse_count, last_fall_ns + MOD_WSLEDS_LATCH_US * 1000ull);
+	}
+	return ok;
+}
+
+static void usage() {
+	printf("usage: pio_timing [options]\n"
+	       "  --sys-mhz N[,N...]  system clocks (default 48,125,150,200,250)\n"
+	       "  --cycle-ns N        PIO cycle to try instead of the driver's (98 ns RGB/GRB, 102 ns GRBW/RGBW)\n"
+	       "  --vcd DIR           write pin waveforms as VCD\n");
+}
+
+int main(const int argc, char **argv) {
+	u32 clocks[MAX_CLOCKS] = { 48, 125, 150, 200, 250 };
+	u32 clock_count = 5;
+	u32 cycle_ns = 0;
+	const char *vcd_dir = nullptr;
+
+	for (i32 i = 1; i < argc; i++) {
+		const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+		if (strcmp(argv[i], "--sys-mhz") == 0 && value != nullptr) {
+			clock_count = 0;
+			for (char *end = (char *)value; *end && clock_count < MAX_CLOCKS; end += *end == ',') {
+				clocks[clock_count++] = strtoul(end, &end, 10);
+			}
+		} else if (strcmp(argv[i], "--cycle-ns") == 0 && value != nullptr) cycle_ns = strtoul(value, nullptr, 10);
+		else if (strcmp(argv[i], "--vcd") == 0 && value != nullptr) vcd_dir = value;
+		else {
+			usage();
+			return 2;
+		}
+		i++;
+	}
+
+	if (vcd_dir != nullptr && mkdir(vcd_dir, 0755) != 0 && errno != EEXIST) {
+		printf("!!! can't create %s\n", vcd_dir);
+		return 1;
+	}
+
+	printf("%5s  %-5s %8s   %9s   %9s   %9s   %9s   %6s %8s %9s\n", "MHz", "fmt", "div", "T0H ns", "T0L ns",
+	       "T1H ns", "T1L ns", "bit ns", "frame us", "latch +us");
+	bool ok = true;
+	for (u32 c = 0; c < clock_count; c++) {
+		if (clocks[c] == 0) {
+			usage();
+			return 2;
+		}
+		for (u32 format = 0; format < ARRAY_SIZE(FORMAT_NAMES); format++) {
+			ok &= check(clocks[c] * 1'000'000, format, cycle_ns, vcd_dir);
+		}
+	}
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,308 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*
+ * pixels.h check and microbenchmark - the host has no DSP extension, so this runs the plain C SWAR fallbacks:
+ * - every per-word helper against a per-channel reference on every byte pair (in each channel, next to carry/borrow
+ *   provoking neighbours) and on random words, for every scale/blend factor
+ * - buffer kernels against the same reference
+ * - ns per pixel of fill, scale, blend, add, sub and fade next to the per-channel loop they replace
+ *
+ *   pixels_bench                           check + benchmark (1024 pixels, 20000 rounds)
+ *   pixels_bench --leds 256 --rounds 0     check only
+ *
+ * Exit code 1 on any mismatch. Times are host ns - compare runs, not boards.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pixels.h"
+
+#define RANDOM_WORDS 200'000
+
+typedef u32 (*channel_op_t)(u32 a, u32 b, u32 arg);
+
+static u32 failures = 0;
+
+static u32 ref_scale(const u32 a, const u32, const u32 scale) { return a * scale >> 8; }
+static u32 ref_blend(const u32 a, const u32 b, const u32 t) { return (a * (256 - t) + b * t) >> 8; }
+static u32 ref_add(const u32 a, const u32 b, const u32) { return a + b > 255 ? 255 : a + b; }
+static u32 ref_sub(const u32 a, const u32 b, const u32) { return a > b ? a - b : 0; }
+static u32 ref_sub_amount(const u32 a, const u32, const u32 amount) { return a > amount ? a - amount : 0; }
+static u32 ref_max(const u32 a, const u32 b, const u32) { return a > b ? a : b; }
+static u32 ref_multiply(const u32 a, const u32 b, const u32) { return a * b / 255; }
+
+static u32 reference(const channel_op_t op, const u32 a, const u32 b, const u32 arg) {
+	u32 result = 0;
+	for (u32 shift = 0; shift < 32; shift += 8) result |= op((a >> shift) & 0xFFu, (b >> shift) & 0xFFu, arg) << shift;
+	return result;
+}
+
+static u32 swar_scale(const u32 a, const u32, const u32 scale) { return pixels_scale_color(a, scale); }
+static u32 swar_blend(const u32 a, const u32 b, const u32 t) { return pixels_blend_color(a, b, t); }
+static u32 swar_add(const u32 a, const u32 b, const u32) { return pixels_add_color(a, b); }
+static u32 swar_sub(const u32 a, const u32 b, const u32) { return pixels_sub_color(a, b); }
+static u32 swar_max(const u32 a, const u32 b, const u32) { return pixels_max_color(a, b); }
+static u32 swar_multiply(const u32 a, const u32 b, const u32) { return pixels_multiply_color(a, b); }
+
+typedef struct {
+	const char *name;
+	u32 (*swar)(u32 a, u32 b, u32 arg);
+	channel_op_t channel;
+	u32 arg_max; // arg runs 0..arg_max (scale/blend factor), 0 - no arg
+} helper_t;
+
+static const helper_t HELPERS[] = {
+	{ "scale_color", swar_scale, ref_scale, 256 },
+	{ "blend_color", swar_blend, ref_blend, 256 },
+	{ "add_color", swar_add, ref_add, 0 },
+	{ "sub_color", swar_sub, ref_sub, 0 },
+	{ "max_color", swar_max, ref_max, 0 },
+	{ "multiply_color", swar_multiply, ref_multiply, 0 },
+};
+
+static u32 rng_state = 0x2545F491u;
+
+static u32 next_random() { // xorshift32, fixed seed so failures repeat
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+static bool expect(const char *name, const u32 a, const u32 b, const u32 arg, const u32 got, const u32 want) {
+	if (got == want) return true;
+	if (failures++ < 10) {
+		fprintf(stderr, "%s(0x%08X, 0x%08X, %u) = 0x%08X, expected 0x%08X\n", name, a, b, arg, got, want);
+	}
+	return false;
+}
+
+static bool check_pair(const helper_t *helper, const u32 a, const u32 b, const u32 arg) {
+	return expect(helper->name, a, b, arg, helper->swar(a, b, arg), reference(helper->channel, a, b, arg));
+}
+
+// every byte pair in every channel, with the other channels at 0x00, 0xFF and the pair itself (carry/borrow into
+// and out of the channel under test), then random words
+static void check_helper(const helper_t *helper) {
+	const u32 start_failures = failures;
+	for (u32 arg = 0; arg <= helper->arg_max; arg++) {
+		const bool exhaustive = helper->arg_max == 0 || arg % 32 == 0 || arg >= 255;
+		for (u32 x = 0; exhaustive && x < 256; x++) {
+			for (u32 y = 0; y < 256; y++) {
+				for (u32 shift = 0; shift < 32; shift += 8) {
+					const u32 other = ~(0xFFu << shift);
+					check_pair(helper, x << shift, y << shift, arg);
+					check_pair(helper, x << shift | other, y << shift | other, arg);
+					check_pair(helper, x << shift | other, y << shift, arg);
+					check_pair(helper, x << shift, y << shift | other, arg);
+				}
+				check_pair(helper, x * 0x01010101u, y * 0x01010101u, arg);
+			}
+		}
+		for (u32 i = 0; i < RANDOM_WORDS / (helper->arg_max + 1); i++) {
+			check_pair(helper, next_random(), next_random(), arg);
+		}
+		if (failures != start_failures) break;
+	}
+	printf("  %-16s %s\n", helper->name, failures == start_failures ? "ok" : "FAIL");
+}
+
+static void randomize(u32 *buffer, const u32 count) {
+	for (u32 i = 0; i < count; i++) buffer[i] = next_random();
+}
+
+static void check_buffer(const char *name, const u32 *got, const u32 *want, const u32 count) {
+	const u32 start_failures = failures;
+	for (u32 i = 0; i < count; i++) {
+		if (got[i] != want[i] && failures++ < 10) {
+			fprintf(stderr, "%s: pixel %u = 0x%08X, expected 0x%08X\n", name, i, got[i], want[i]);
+		}
+	}
+	printf("  %-16s %s\n", name, failures == start_failures ? "ok" : "FAIL");
+}
+
+static void check_buffers(u32 *a, u32 *b, u32 *dst, u32 *want, const u32 count) {
+	static constexpr u32 SCALES[] = { 0, 1, 127, 128, 255, 256, 300 };
+	static constexpr u8 AMOUNTS[] = { 0, 1, 64, 128, 254, 255 };
+
+	randomize(a, count);
+	const u32 color = next_random();
+	pixels_fill(dst, count, color);
+	for (u32 i = 0; i < count; i++) want[i] = color;
+	check_buffer("fill", dst, want, count);
+
+	bool ok = true;
+	for (u32 s = 0; ok && s < sizeof(SCALES) / sizeof(SCALES[0]); s++) {
+		const u32 scale = SCALES[s] > 256 ? 256 : SCALES[s]; // above 256 is identity like 256
+		memcpy(dst, a, count * sizeof(u32));
+		pixels_scale(dst, count, SCALES[s]);
+		for (u32 i = 0; i < count; i++) want[i] = reference(ref_scale, a[i], 0, scale);
+		ok = memcmp(dst, want, count * sizeof(u32)) == 0;
+	}
+	check_buffer("scale", dst, want, count);
+
+	randomize(b, count);
+	ok = true;
+	for (u32 t = 0; ok && t <= 256; t++) {
+		pixels_blend(dst, a, b, count, t);
+		for (u32 i = 0; i < count; i++) want[i] = reference(ref_blend, a[i], b[i], t);
+		ok = memcmp(dst, want, count * sizeof(u32)) == 0;
+	}
+	check_buffer("blend", dst, want, count);
+
+	memcpy(dst, a, count * sizeof(u32));
+	pixels_blend(dst, dst, b, count, 77); // aliased
+	for (u32 i = 0; i < count; i++) want[i] = reference(ref_blend, a[i], b[i], 77);
+	check_buffer("blend aliased", dst, want, count);
+
+	memcpy(dst, a, count * sizeof(u32));
+	pixels_add_saturating(dst, b, count);
+	for (u32 i = 0; i < count; i++) want[i] = reference(ref_add, a[i], b[i], 0);
+	check_buffer("add_saturating", dst, want, count);
+
+	ok = true;
+	for (u32 m = 0; ok && m < sizeof(AMOUNTS) / sizeof(AMOUNTS[0]); m++) {
+		memcpy(dst, a, count * sizeof(u32));
+		pixels_sub_saturating(dst, count, AMOUNTS[m]);
+		for (u32 i = 0; i < count; i++) want[i] = reference(ref_sub, a[i], AMOUNTS[m] * 0x01010101u, 0);
+		ok = memcmp(dst, want, count * sizeof(u32)) == 0;
+	}
+	check_buffer("sub_saturating", dst, want, count);
+
+	ok = true;
+	for (u32 m = 0; ok && m < sizeof(AMOUNTS) / sizeof(AMOUNTS[0]); m++) {
+		memcpy(dst, a, count * sizeof(u32));
+		pixels_fade_to_black(dst, count, AMOUNTS[m]);
+		for (u32 i = 0; i < count; i++) want[i] = reference(ref_scale, a[i], 0, 256u - AMOUNTS[m]);
+		ok = memcmp(dst, want, count * sizeof(u32)) == 0;
+	}
+	check_buffer("fade_to_black", dst, want, count);
+}
+
+static u64 now_ns() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1'000'000'000 + ts.tv_nsec;
+}
+
+// per-channel loops the kernels replace - noinline so they aren't folded into the timing loop
+[[gnu::noinline]] static void channel_fill(u32 *dst, const u32 count, const u32 color) {
+	u8 *bytes = (u8 *)dst;
+	for (u32 i = 0; i < count * 4; i++) bytes[i] = (u8)(color >> (i % 4 * 8));
+}
+
+[[gnu::noinline]] static void channel_binary(u32 *dst, const u32 *a, const u32 *b, const u32 count,
+                                             const channel_op_t op, const u32 arg) {
+	for (u32 i = 0; i < count; i++) dst[i] = reference(op, a[i], b[i], arg);
+}
+
+typedef enum {
+	BENCH_FILL, BENCH_SCALE, BENCH_BLEND, BENCH_ADD, BENCH_SUB, BENCH_FADE, BENCH_COUNT
+} bench_t;
+
+static const char *BENCH_NAMES[] = {
+	[BENCH_FILL] = "fill", [BENCH_SCALE] = "scale", [BENCH_BLEND] = "blend", [BENCH_ADD] = "add_saturating",
+	[BENCH_SUB] = "sub_saturating", [BENCH_FADE] = "fade_to_black"
+};
+
+static void run_kernel(const bench_t bench, const bool packed, u32 *dst, const u32 *a, const u32 *b, const u32 count,
+                       const u32 round) {
+	const u32 arg = 1 + round % 255; // never 0 / 256 - those take the early outs
+	switch (bench) {
+		case BENCH_FILL:
+			if (packed) pixels_fill(dst, count, a[round % count]);
+			else channel_fill(dst, count, a[round % count]);
+			break;
+		case BENCH_SCALE:
+			if (packed) pixels_scale(dst, count, arg);
+			else channel_binary(dst, dst, dst, count, ref_scale, arg);
+			break;
+		case BENCH_BLEND:
+			if (packed) pixels_blend(dst, a, b, count, arg);
+			else channel_binary(dst, a, b, count, ref_blend, arg);
+			break;
+		case BENCH_ADD:
+			if (packed) pixels_add_saturating(dst, b, count);
+			else channel_binary(dst, dst, b, count, ref_add, 0);
+			break;
+		case BENCH_SUB:
+			if (packed) pixels_sub_saturating(dst, count, (u8)arg);
+			else channel_binary(dst, dst, dst, count, ref_sub_amount, arg);
+			break;
+		case BENCH_FADE:
+			if (packed) pixels_fade_to_black(dst, count, (u8)arg);
+			else channel_binary(dst, dst, dst, count, ref_scale, 256 - arg);
+			break;
+		default:
+			break;
+	}
+}
+
+static double time_kernel(const bench_t bench, const bool packed, u32 *dst, const u32 *a, const u32 *b,
+                          const u32 count, const u32 rounds) {
+	u64 total = 0;
+	for (u32 round = 0; round < rounds; round++) {
+		memcpy(dst, a, count * sizeof(u32)); // scale/sub/fade would reach black and stay there
+		const u64 start = now_ns();
+		run_kernel(bench, packed, dst, a, b, count, round);
+		total += now_ns() - start;
+	}
+	return (double)total / rounds / count;
+}
+
+static void run_bench(u32 *a, u32 *b, u32 *dst, const u32 count, const u32 rounds) {
+	randomize(a, count);
+	randomize(b, count);
+	printf("\n%-16s %12s %12s %8s   (%u pixels, %u rounds)\n", "kernel", "ns/px", "channel ns", "speedup", count,
+	       rounds);
+	for (u32 bench = 0; bench < BENCH_COUNT; bench++) {
+		const double packed = time_kernel(bench, true, dst, a, b, count, rounds);
+		const double channel = time_kernel(bench, false, dst, a, b, count, rounds);
+		printf("%-16s %12.3f %12.3f %7.2fx\n", BENCH_NAMES[bench], packed, channel, channel / packed);
+	}
+}
+
+static void usage(const char *name) {
+	printf("usage: %s [options]\n"
+	       "  --leds N     pixels per buffer (default 1024)\n"
+	       "  --rounds N   benchmark rounds per kernel (default 20000, 0 - check only)\n", name);
+}
+
+int main(const int argc, char **argv) {
+	u32 count = 1024;
+	u32 rounds = 20'000;
+	for (int i = 1; i < argc; i++) {
+		const char *arg = argv[i];
+		const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+		if (strcmp(arg, "--leds") == 0 && value != nullptr) count = strtoul(value, nullptr, 10), i++;
+		else if (strcmp(arg, "--rounds") == 0 && value != nullptr) rounds = strtoul(value, nullptr, 10), i++;
+		else {
+			usage(argv[0]);
+			return strcmp(arg, "--help") == 0 ? 0 : 2;
+		}
+	}
+	if (count == 0) count = 1;
+
+	u32 *a = malloc(count * sizeof(u32));
+	u32 *b = malloc(count * sizeof(u32));
+	u32 *dst = malloc(count * sizeof(u32));
+	u32 *want = malloc(count * sizeof(u32));
+	if (a == nullptr || b == nullptr || dst == nullptr || want == nullptr) return 2;
+
+	printf("pixels (%s)\n", PIXELS_DSP ? "DSP" : "C fallbacks");
+	for (u32 i = 0; i < sizeof(HELPERS) / sizeof(HELPERS[0]); i++) check_helper(&HELPERS[i]);
+	check_buffers(a, b, dst, want, count);
+
+	if (failures == 0 && rounds > 0) run_bench(a, b, dst, count, rounds);
+
+	free(a);
+	free(b);
+	free(dst);
+	free(want);
+	if (failures > 0) printf("%u mismatches\n", failures);
+	return failures > 0 ? 1 : 0;
+}
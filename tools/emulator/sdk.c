@@ -0,0 +1,632 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <hardware/clocks.h>
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+#include <hardware/pio.h>
+#include <hardware/pwm.h>
+#include <hardware/sync.h>
+#include <pico/multicore.h>
+#include <pico/rand.h>
+#include <pico/status_led.h>
+#include <pico/time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+
+#define MAX_ALARMS 16
+#define NUM_IRQS 64
+#define PIO_TX_FIFO_DEPTH 8 // joined
+#define DREQ_PWM_WRAP0 32
+#define DREQ_FORCE 63
+#define ENDLESS_COUNT 0xF0000000u
+
+typedef struct {
+	bool active;
+	u64 at;
+	alarm_callback_t callback;
+	void *user_data;
+} alarm_t;
+
+typedef struct {
+	bool claimed;
+	bool busy;
+	bool raw_irq;
+	u64 done_at;
+	dma_channel_config config;
+	u32 count; // reloaded on every trigger
+	u32 *words; // stream as the SM sees it, handed to tx hook on completion
+	u32 words_cap;
+} channel_t;
+
+typedef struct {
+	bool enabled;
+	u16 wrap;
+	u16 div_fx; // 8.4
+	u64 next_wrap_us;
+} slice_t;
+
+static u64 now_us = 0;
+static u32 sys_hz = 150'000'000;
+static u32 bit_cycles = 12;
+static u32 rand_state = 0x2545F491u;
+static host_tx_hook_t tx_hook = nullptr;
+static void *tx_hook_data = nullptr;
+
+static alarm_t alarms[MAX_ALARMS] = { };
+static channel_t channels[NUM_DMA_CHANNELS] = { };
+static dma_hw_t dma_hw_regs = { };
+static u32 irq_enabled_mask[2] = { }; // per DMA IRQ index
+static irq_handler_t irq_handlers[NUM_IRQS] = { };
+static bool irq_enabled[NUM_IRQS] = { };
+static slice_t slices[NUM_PWM_SLICES] = { };
+static pwm_hw_t pwm_hw_regs = { };
+
+static u16 pio_memory[NUM_PIOS][PIO_INSTRUCTION_COUNT] = { };
+static u32 pio_used[NUM_PIOS] = { };
+static host_pio_sm_t pio_sms[NUM_PIOS][NUM_PIO_STATE_MACHINES] = { };
+
+pio_hw_t pio_hw_blocks[NUM_PIOS] = { };
+dma_hw_t *dma_hw = &dma_hw_regs;
+pwm_hw_t *pwm_hw = &pwm_hw_regs;
+
+// --- host API
+
+void host_set_tx_hook(const host_tx_hook_t hook, void *user_data) {
+	tx_hook = hook;
+	tx_hook_data = user_data;
+}
+
+void host_set_sys_clock_hz(const u32 hz) {
+	sys_hz = hz;
+}
+
+void host_set_pio_bit_cycles(const u32 cycles) {
+	bit_cycles = cycles;
+}
+
+const host_pio_sm_t *host_pio_sm(const PIO pio, const uint sm) {
+	return &pio_sms[pio_get_index(pio)][sm];
+}
+
+const u16 *host_pio_memory(const PIO pio) {
+	return pio_memory[pio_get_index(pio)];
+}
+
+// --- DMA
+
+static void raise_irq(const uint channel) {
+	channels[channel].raw_irq = true;
+	for (u32 index = 0; index < 2; index++) {
+		const uint num = index == 0 ? DMA_IRQ_0 : DMA_IRQ_1;
+		if ((irq_enabled_mask[index] & 1u << channel) && irq_enabled[num] && irq_handlers[num] != nullptr) {
+			irq_handlers[num]();
+		}
+	}
+}
+
+static bool pio_tx_target(const uintptr_t addr, uint *pio_index, uint *sm) {
+	for (uint p = 0; p < NUM_PIOS; p++) {
+		const uintptr_t base = (uintptr_t)pio_hw_blocks[p].txf;
+		if (addr >= base && addr < base + sizeof pio_hw_blocks[p].txf) {
+			*pio_index = p;
+			*sm = (addr - base) / sizeof(u32);
+			return true;
+		}
+	}
+	return false;
+}
+
+static i32 trigger_target(const uintptr_t addr) {
+	for (u32 ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+		if (addr == (uintptr_t)&dma_hw->ch[ch].al3_read_addr_trig) return (i32)ch;
+	}
+	return -1;
+}
+
+static void start_channel(const uint channel) {
+	auto c = &channels[channel];
+	auto hw = &dma_hw->ch[channel];
+	const u32 count = c->count;
+	uint pio_index, sm;
+
+	if ((count & ENDLESS_COUNT) == ENDLESS_COUNT || c->config.dreq >= DREQ_PWM_WRAP0) {
+		c->busy = true; // paced by PWM wraps, see run_pwm_wrap
+		c->done_at = UINT64_MAX;
+		return;
+	}
+
+	if (pio_tx_target(hw->write_addr, &pio_index, &sm)) {
+		// DREQ lets DMA run FIFO depth ahead of the SM, DMA is done when the last word is in the FIFO
+		const float clkdiv = pio_sms[pio_index][sm].config.clkdiv;
+		const u32 paced_words = count > PIO_TX_FIFO_DEPTH ? count - PIO_TX_FIFO_DEPTH : 0;
+		const u64 cycles = (u64)paced_words * 32 * bit_cycles;
+		c->busy = true;
+		c->done_at = now_us + (u64)((float)cycles * clkdiv * 1'000'000.0f / (float)sys_hz);
+		return;
+	}
+
+	// plain memory copy - instant
+	const size_t size = 1u << c->config.size;
+	for (u32 i = 0; i < count; i++) {
+		memcpy((u8 *)hw->write_addr + (c->config.write_increment ? i * size : 0),
+		       (const u8 *)hw->read_addr + (c->config.read_increment ? i * size : 0), size);
+	}
+	raise_irq(channel);
+}
+
+// stream is copied only now (the buffer must not change while DMA reads it anyway), so it's not timed with present
+static void complete_channel(const uint channel) {
+	auto c = &channels[channel];
+	auto hw = &dma_hw->ch[channel];
+	uint pio_index, sm;
+	c->busy = false;
+	if (tx_hook != nullptr && pio_tx_target(hw->write_addr, &pio_index, &sm)) {
+		const u32 count = c->count;
+		if (count > c->words_cap) {
+			c->words = realloc(c->words, count * sizeof(u32));
+			c->words_cap = count;
+		}
+		const u32 *src = (const u32 *)hw->read_addr;
+		for (u32 i = 0; i < count; i++) {
+			const u32 word = src[c->config.read_increment ? i : 0];
+			c->words[i] = c->config.bswap ? __builtin_bswap32(word) : word;
+		}
+		tx_hook(&pio_hw_blocks[pio_index], sm, c->words, count, tx_hook_data);
+	}
+	raise_irq(channel);
+}
+
+bool dma_channel_is_claimed(const uint channel) {
+	return channels[channel].claimed;
+}
+
+void dma_channel_claim(const uint channel) {
+	channels[channel].claimed = true;
+}
+
+void dma_channel_unclaim(const uint channel) {
+	channels[channel].claimed = false;
+}
+
+dma_channel_config dma_channel_get_default_config(const uint channel) {
+	(void)channel;
+	return (dma_channel_config){ .size = DMA_SIZE_32, .read_increment = true, .dreq = DREQ_FORCE };
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, const enum dma_channel_transfer_size size) {
+	c->size = size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, const bool incr) {
+	c->read_increment = incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, const bool incr) {
+	c->write_increment = incr;
+}
+
+void channel_config_set_bswap(dma_channel_config *c, const bool bswap) {
+	c->bswap = bswap;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, const uint dreq) {
+	c->dreq = dreq;
+}
+
+void dma_channel_configure(const uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, const uint32_t transfer_count, const bool trigger) {
+	channels[channel].config = *config;
+	channels[channel].count = transfer_count;
+	dma_hw->ch[channel].write_addr = (uintptr_t)write_addr;
+	dma_hw->ch[channel].read_addr = (uintptr_t)read_addr;
+	dma_hw->ch[channel].transfer_count = transfer_count;
+	if (trigger) start_channel(channel);
+}
+
+void dma_channel_set_trans_count(const uint channel, const uint32_t trans_count, const bool trigger) {
+	channels[channel].count = trans_count;
+	dma_hw->ch[channel].transfer_count = trans_count;
+	if (trigger) start_channel(channel);
+}
+
+void dma_channel_transfer_from_buffer_now(const uint channel, const volatile void *read_addr,
+                                          const uint32_t transfer_count) {
+	dma_hw->ch[channel].read_addr = (uintptr_t)read_addr;
+	dma_channel_set_trans_count(channel, transfer_count, true);
+}
+
+bool dma_channel_is_busy(const uint channel) {
+	return channels[channel].busy;
+}
+
+void dma_channel_wait_for_finish_blocking(const uint channel) {
+	while (channels[channel].busy) tight_loop_contents();
+}
+
+void dma_channel_abort(const uint channel) {
+	channels[channel].busy = false;
+}
+
+uint32_t dma_encode_endless_transfer_count() {
+	return ENDLESS_COUNT;
+}
+
+void dma_irqn_set_channel_enabled(const uint irq_index, const uint channel, const bool enabled) {
+	if (enabled) irq_enabled_mask[irq_index] |= 1u << channel;
+	else irq_enabled_mask[irq_index] &= ~(1u << channel);
+}
+
+bool dma_irqn_get_channel_status(const uint irq_index, const uint channel) {
+	return channels[channel].raw_irq && (irq_enabled_mask[irq_index] & 1u << channel);
+}
+
+void dma_irqn_acknowledge_channel(const uint irq_index, const uint channel) {
+	(void)irq_index;
+	channels[channel].raw_irq = false;
+}
+
+// --- IRQ
+
+void irq_add_shared_handler(const uint num, const irq_handler_t handler, const uint8_t order_priority) {
+	(void)order_priority;
+	irq_handlers[num] = handler; // one shared handler per IRQ is all the LED modules install
+}
+
+void irq_remove_handler(const uint num, const irq_handler_t handler) {
+	if (irq_handlers[num] == handler) irq_handlers[num] = nullptr;
+}
+
+void irq_set_enabled(const uint num, const bool enabled) {
+	irq_enabled[num] = enabled;
+}
+
+// --- PWM (only as frame timer for paced DMA)
+
+static u64 wrap_period_us(const slice_t *s) {
+	const u64 period = ((u64)s->wrap + 1) * s->div_fx * 1'000'000 / 16 / sys_hz;
+	return period > 0 ? period : 1;
+}
+
+// one DREQ per wrap - paced channel moves one word, writing a trigger alias restarts that channel
+static void run_pwm_wrap(const uint slice) {
+	for (u32 ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+		auto c = &channels[ch];
+		if (!c->busy || c->config.dreq != DREQ_PWM_WRAP0 + slice) continue;
+
+		auto hw = &dma_hw->ch[ch];
+		const i32 target = trigger_target(hw->write_addr);
+		if (target >= 0) {
+			dma_hw->ch[target].read_addr = *(const uintptr_t *)hw->read_addr; // pointer sized on host
+			start_channel(target);
+		} else {
+			memcpy((void *)hw->write_addr, (const void *)hw->read_addr, 1u << c->config.size);
+		}
+
+		if ((c->count & ENDLESS_COUNT) != ENDLESS_COUNT && --c->count == 0) complete_channel(ch);
+	}
+}
+
+void pwm_set_wrap(const uint slice_num, const uint16_t wrap) {
+	slices[slice_num].wrap = wrap;
+}
+
+void pwm_set_clkdiv_int_frac4(const uint slice_num, const uint8_t integer, const uint8_t fract) {
+	slices[slice_num].div_fx = (u16)(integer << 4 | fract);
+}
+
+void pwm_set_counter(const uint slice_num, const uint16_t c) {
+	(void)c;
+	slices[slice_num].next_wrap_us = now_us + wrap_period_us(&slices[slice_num]);
+}
+
+void pwm_set_enabled(const uint slice_num, const bool enabled) {
+	auto s = &slices[slice_num];
+	if (enabled && !s->enabled) s->next_wrap_us = now_us + wrap_period_us(s);
+	s->enabled = enabled;
+}
+
+uint pwm_get_dreq(const uint slice_num) {
+	return DREQ_PWM_WRAP0 + slice_num;
+}
+
+// --- PIO
+
+uint pio_get_index(const PIO pio) {
+	return (uint)(pio - pio_hw_blocks);
+}
+
+int pio_add_program(const PIO pio, const pio_program_t *program) {
+	const uint index = pio_get_index(pio);
+	const u32 mask = (1u << program->length) - 1;
+
+	// same search as the SDK - from the top of instruction memory down
+	for (i32 offset = PIO_INSTRUCTION_COUNT - program->length; offset >= 0; offset--) {
+		if (program->origin >= 0 && offset != program->origin) continue;
+		if (pio_used[index] & mask << offset) continue;
+
+		for (u32 i = 0; i < program->length; i++) {
+			const u16 instr = program->instructions[i];
+			pio_memory[index][offset + i] = (instr & 0xE000) == 0 ? instr + offset : instr; // relocate JMP
+		}
+		pio_used[index] |= mask << offset;
+		return offset;
+	}
+	return -1;
+}
+
+void pio_remove_program(const PIO pio, const pio_program_t *program, const uint loaded_offset) {
+	pio_used[pio_get_index(pio)] &= ~(((1u << program->length) - 1) << loaded_offset);
+}
+
+bool pio_sm_is_claimed(const PIO pio, const uint sm) {
+	return pio_sms[pio_get_index(pio)][sm].claimed;
+}
+
+void pio_sm_claim(const PIO pio, const uint sm) {
+	pio_sms[pio_get_index(pio)][sm].claimed = true;
+}
+
+void pio_sm_unclaim(const PIO pio, const uint sm) {
+	pio_sms[pio_get_index(pio)][sm].claimed = false;
+}
+
+uint pio_get_dreq(const PIO pio, const uint sm, const bool is_tx) {
+	return pio_get_index(pio) * 8 + sm + (is_tx ? 0 : 4);
+}
+
+void pio_gpio_init(const PIO pio, const uint pin) {
+	(void)pio;
+	(void)pin;
+}
+
+int pio_sm_set_consecutive_pindirs(const PIO pio, const uint sm, const uint pin_base, const uint pin_count,
+                                   const bool is_out) {
+	(void)pio;
+	(void)sm;
+	(void)pin_base;
+	(void)pin_count;
+	(void)is_out;
+	return 0;
+}
+
+int pio_sm_init(const PIO pio, const uint sm, const uint initial_pc, const pio_sm_config *config) {
+	auto state = &pio_sms[pio_get_index(pio)][sm];
+	state->config = *config;
+	state->initial_pc = initial_pc;
+	state->enabled = false;
+	return 0;
+}
+
+void pio_sm_set_enabled(const PIO pio, const uint sm, const bool enabled) {
+	pio_sms[pio_get_index(pio)][sm].enabled = enabled;
+}
+
+pio_sm_config pio_get_default_sm_config() {
+	return (pio_sm_config){
+		.clkdiv = 1.0f,
+		.wrap = PIO_INSTRUCTION_COUNT - 1,
+		.out_count = 32,
+		.out_shift_right = true,
+		.pull_threshold = 32,
+		.in_shift_right = true,
+		.push_threshold = 32,
+	};
+}
+
+void sm_config_set_wrap(pio_sm_config *c, const uint wrap_target, const uint wrap) {
+	c->wrap_target = wrap_target;
+	c->wrap = wrap;
+}
+
+void sm_config_set_sideset(pio_sm_config *c, const uint bit_count, const bool optional, const bool pindirs) {
+	c->sideset_bits = bit_count;
+	c->sideset_optional = optional;
+	c->sideset_pindirs = pindirs;
+}
+
+void sm_config_set_sideset_pins(pio_sm_config *c, const uint sideset_base) {
+	c->sideset_base = sideset_base;
+}
+
+void sm_config_set_out_pins(pio_sm_config *c, const uint out_base, const uint out_count) {
+	c->out_base = out_base;
+	c->out_count = out_count;
+}
+
+void sm_config_set_set_pins(pio_sm_config *c, const uint set_base, const uint set_count) {
+	c->set_base = set_base;
+	c->set_count = set_count;
+}
+
+void sm_config_set_jmp_pin(pio_sm_config *c, const uint pin) {
+	c->jmp_pin = pin;
+}
+
+void sm_config_set_out_shift(pio_sm_config *c, const bool shift_right, const bool autopull, const uint pull_threshold) {
+	c->out_shift_right = shift_right;
+	c->autopull = autopull;
+	c->pull_threshold = pull_threshold;
+}
+
+void sm_config_set_in_shift(pio_sm_config *c, const bool shift_right, const bool autopush, const uint push_threshold) {
+	c->in_shift_right = shift_right;
+	c->autopush = autopush;
+	c->push_threshold = push_threshold;
+}
+
+void sm_config_set_fifo_join(pio_sm_config *c, const enum pio_fifo_join join) {
+	c->join_tx = join == PIO_FIFO_JOIN_TX;
+	c->join_rx = join == PIO_FIFO_JOIN_RX;
+}
+
+void sm_config_set_clkdiv(pio_sm_config *c, const float div) {
+	c->clkdiv = div;
+}
+
+// --- time
+
+// earliest pending event, UINT64_MAX when there's none
+static u64 next_event_us() {
+	u64 next = UINT64_MAX;
+	for (u32 i = 0; i < MAX_ALARMS; i++) {
+		if (alarms[i].active && alarms[i].at < next) next = alarms[i].at;
+	}
+	for (u32 ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+		if (channels[ch].busy && channels[ch].done_at < next) next = channels[ch].done_at;
+	}
+	for (u32 s = 0; s < NUM_PWM_SLICES; s++) {
+		if (slices[s].enabled && slices[s].next_wrap_us < next) next = slices[s].next_wrap_us;
+	}
+	return next;
+}
+
+// runs every event due at exactly now_us
+static void run_due_events() {
+	for (u32 i = 0; i < MAX_ALARMS; i++) {
+		auto alarm = &alarms[i];
+		if (!alarm->active || alarm->at > now_us) continue;
+		alarm->active = false;
+		const i64 again = alarm->callback((alarm_id_t)i + 1, alarm->user_data);
+		if (again != 0) {
+			alarm->at = again > 0 ? alarm->at + again : now_us - again; // same as SDK: > 0 from last target
+			alarm->active = true;
+		}
+	}
+	for (u32 ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+		if (channels[ch].busy && channels[ch].done_at <= now_us) complete_channel(ch);
+	}
+	for (u32 s = 0; s < NUM_PWM_SLICES; s++) {
+		auto slice = &slices[s];
+		if (!slice->enabled || slice->next_wrap_us > now_us) continue;
+		slice->next_wrap_us += wrap_period_us(slice);
+		run_pwm_wrap(s);
+	}
+}
+
+static void run_until(const u64 target_us) {
+	while (true) {
+		const u64 next = next_event_us();
+		if (next > target_us) break;
+		if (next > now_us) now_us = next;
+		run_due_events();
+	}
+	now_us = target_us;
+}
+
+void host_advance_us(const u64 us) {
+	run_until(now_us + us);
+}
+
+void host_run_idle() {
+	while (true) {
+		u64 next = UINT64_MAX;
+		for (u32 i = 0; i < MAX_ALARMS; i++) {
+			if (alarms[i].active && alarms[i].at < next) next = alarms[i].at;
+		}
+		for (u32 ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+			if (channels[ch].busy && channels[ch].done_at < next) next = channels[ch].done_at;
+		}
+		if (next == UINT64_MAX) return;
+		run_until(next > now_us ? next : now_us);
+	}
+}
+
+void tight_loop_contents() {
+	const u64 next = next_event_us();
+	run_until(next != UINT64_MAX && next > now_us ? next : now_us + 1);
+}
+
+uint32_t time_us_32() {
+	return (u32)now_us;
+}
+
+uint64_t time_us_64() {
+	return now_us;
+}
+
+void sleep_ms(const uint32_t ms) {
+	host_advance_us((u64)ms * 1000);
+}
+
+void sleep_us(const uint64_t us) {
+	host_advance_us(us);
+}
+
+void busy_wait_us(const uint64_t us) {
+	host_advance_us(us);
+}
+
+void busy_wait_until(const absolute_time_t t) {
+	if (t > now_us) run_until(t);
+}
+
+absolute_time_t get_absolute_time() {
+	return now_us;
+}
+
+absolute_time_t make_timeout_time_us(const uint64_t us) {
+	return now_us + us;
+}
+
+int64_t absolute_time_diff_us(const absolute_time_t from, const absolute_time_t to) {
+	return (i64)(to - from);
+}
+
+alarm_id_t add_alarm_in_us(const uint64_t us, const alarm_callback_t callback, void *user_data,
+                           const bool fire_if_past) {
+	(void)fire_if_past;
+	for (u32 i = 0; i < MAX_ALARMS; i++) {
+		if (alarms[i].active) continue;
+		alarms[i] = (alarm_t){ .active = true, .at = now_us + us, .callback = callback, .user_data = user_data };
+		return (alarm_id_t)i + 1;
+	}
+	return -1;
+}
+
+bool cancel_alarm(const alarm_id_t id) {
+	if (id <= 0 || id > MAX_ALARMS || !alarms[id - 1].active) return false;
+	alarms[id - 1].active = false;
+	return true;
+}
+
+// --- misc
+
+uint32_t clock_get_hz(const enum clock_index clk_index) {
+	(void)clk_index;
+	return sys_hz;
+}
+
+// deterministic, so captured frames of effects using utils_random_* are reproducible
+uint32_t get_rand_32() {
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+	return rand_state;
+}
+
+uint64_t get_rand_64() {
+	return (u64)get_rand_32() << 32 | get_rand_32();
+}
+
+void multicore_launch_core1(void (*entry)()) {
+	(void)entry;
+	fprintf(stderr, "!!! host has no core1 - entry not started\n");
+}
+
+bool status_led_init() {
+	return false;
+}
+
+bool status_led_set_state(const bool led_on) {
+	(void)led_on;
+	return false;
+}
+
+size_t memory_remaining_heap(const bool print_result) {
+	(void)print_result;
+	return 0;
+}
@@ -0,0 +1,10 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+enum clock_index { clk_sys = 5 };
+
+uint32_t clock_get_hz(enum clock_index clk_index);
@@ -0,0 +1,72 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+#define NUM_DMA_CHANNELS 16
+#define DMA_IRQ_0 10
+#define DMA_IRQ_1 11
+
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+
+typedef struct {
+	enum dma_channel_transfer_size size;
+	bool read_increment;
+	bool write_increment;
+	bool bswap;
+	uint dreq;
+} dma_channel_config;
+
+typedef struct {
+	volatile uintptr_t read_addr; // pointer sized on host
+	volatile uintptr_t write_addr;
+	volatile uint32_t transfer_count;
+	volatile uintptr_t al3_read_addr_trig; // DMA writes here (control channel) restart the channel
+} dma_channel_hw_t;
+
+typedef struct {
+	dma_channel_hw_t ch[NUM_DMA_CHANNELS];
+} dma_hw_t;
+
+extern dma_hw_t *dma_hw;
+
+bool dma_channel_is_claimed(uint channel);
+
+void dma_channel_claim(uint channel);
+
+void dma_channel_unclaim(uint channel);
+
+dma_channel_config dma_channel_get_default_config(uint channel);
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size);
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr);
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr);
+
+void channel_config_set_bswap(dma_channel_config *c, bool bswap);
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq);
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint32_t transfer_count, bool trigger);
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger);
+
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count);
+
+bool dma_channel_is_busy(uint channel);
+
+void dma_channel_wait_for_finish_blocking(uint channel);
+
+void dma_channel_abort(uint channel);
+
+uint32_t dma_encode_endless_transfer_count();
+
+void dma_irqn_set_channel_enabled(uint irq_index, uint channel, bool enabled);
+
+bool dma_irqn_get_channel_status(uint irq_index, uint channel);
+
+void dma_irqn_acknowledge_channel(uint irq_index, uint channel);
@@ -0,0 +1,16 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+typedef void (*irq_handler_t)();
+
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority);
+
+void irq_remove_handler(uint num, irq_handler_t handler);
+
+void irq_set_enabled(uint num, bool enabled);
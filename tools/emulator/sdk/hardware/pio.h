@@ -0,0 +1,99 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+#define NUM_PIOS 3
+#define NUM_PIO_STATE_MACHINES 4
+#define PIO_INSTRUCTION_COUNT 32
+
+typedef struct {
+	volatile uint32_t txf[NUM_PIO_STATE_MACHINES];
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t pio_hw_blocks[NUM_PIOS];
+
+#define pio0 (&pio_hw_blocks[0])
+#define pio1 (&pio_hw_blocks[1])
+#define pio2 (&pio_hw_blocks[2])
+
+typedef struct pio_program {
+	const uint16_t *instructions;
+	uint8_t length;
+	int8_t origin;
+	uint8_t pio_version;
+} pio_program_t;
+
+// decoded, unlike the packed hardware registers - read back by the PIO emulator
+typedef struct {
+	float clkdiv;
+	uint wrap_target;
+	uint wrap;
+	uint sideset_bits; // incl. enable bit
+	bool sideset_optional;
+	bool sideset_pindirs;
+	uint sideset_base;
+	uint out_base;
+	uint out_count;
+	uint set_base;
+	uint set_count;
+	uint jmp_pin;
+	bool out_shift_right;
+	bool autopull;
+	uint pull_threshold;
+	bool in_shift_right;
+	bool autopush;
+	uint push_threshold;
+	bool join_tx;
+	bool join_rx;
+} pio_sm_config;
+
+enum pio_fifo_join { PIO_FIFO_JOIN_NONE = 0, PIO_FIFO_JOIN_TX = 1, PIO_FIFO_JOIN_RX = 2 };
+
+uint pio_get_index(PIO pio);
+
+int pio_add_program(PIO pio, const pio_program_t *program);
+
+void pio_remove_program(PIO pio, const pio_program_t *program, uint loaded_offset);
+
+bool pio_sm_is_claimed(PIO pio, uint sm);
+
+void pio_sm_claim(PIO pio, uint sm);
+
+void pio_sm_unclaim(PIO pio, uint sm);
+
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx);
+
+void pio_gpio_init(PIO pio, uint pin);
+
+int pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out);
+
+int pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config);
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+
+pio_sm_config pio_get_default_sm_config();
+
+void sm_config_set_wrap(pio_sm_config *c, uint wrap_target, uint wrap);
+
+void sm_config_set_sideset(pio_sm_config *c, uint bit_count, bool optional, bool pindirs);
+
+void sm_config_set_sideset_pins(pio_sm_config *c, uint sideset_base);
+
+void sm_config_set_out_pins(pio_sm_config *c, uint out_base, uint out_count);
+
+void sm_config_set_set_pins(pio_sm_config *c, uint set_base, uint set_count);
+
+void sm_config_set_jmp_pin(pio_sm_config *c, uint pin);
+
+void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull, uint pull_threshold);
+
+void sm_config_set_in_shift(pio_sm_config *c, bool shift_right, bool autopush, uint push_threshold);
+
+void sm_config_set_fifo_join(pio_sm_config *c, enum pio_fifo_join join);
+
+void sm_config_set_clkdiv(pio_sm_config *c, float div);
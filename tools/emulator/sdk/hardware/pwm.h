@@ -0,0 +1,32 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+#define NUM_PWM_SLICES 12
+
+typedef struct {
+	volatile uint32_t csr;
+	volatile uint32_t div;
+	volatile uint32_t ctr;
+	volatile uint32_t cc;
+	volatile uint32_t top;
+} pwm_slice_hw_t;
+
+typedef struct {
+	pwm_slice_hw_t slice[NUM_PWM_SLICES];
+} pwm_hw_t;
+
+extern pwm_hw_t *pwm_hw;
+
+void pwm_set_wrap(uint slice_num, uint16_t wrap);
+
+void pwm_set_clkdiv_int_frac4(uint slice_num, uint8_t integer, uint8_t fract);
+
+void pwm_set_counter(uint slice_num, uint16_t c);
+
+void pwm_set_enabled(uint slice_num, bool enabled);
+
+uint pwm_get_dreq(uint slice_num);
@@ -0,0 +1,20 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+// single threaded host - IRQ handlers only run from inside waits, so there's nothing to mask
+static inline uint32_t save_and_disable_interrupts() {
+	return 0;
+}
+
+static inline void restore_interrupts(const uint32_t status) {
+	(void)status;
+}
+
+/**
+ * Spinning on host would never end - runs the next pending event (alarm, DMA completion, PWM wrap) instead
+ */
+void tight_loop_contents();
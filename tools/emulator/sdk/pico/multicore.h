@@ -0,0 +1,10 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+// host has one core - launch only warns, code meant for core1 is driven directly (e.g. compositor_render_frame)
+
+void multicore_launch_core1(void (*entry)());
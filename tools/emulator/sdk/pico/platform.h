@@ -0,0 +1,12 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+#define NUM_CORES 2
+
+static inline uint get_core_num() {
+	return 0;
+}
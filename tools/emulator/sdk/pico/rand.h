@@ -0,0 +1,10 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+uint32_t get_rand_32();
+
+uint64_t get_rand_64();
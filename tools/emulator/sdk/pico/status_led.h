@@ -0,0 +1,12 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+#define PICO_STATUS_LED_AVAILABLE 0
+
+bool status_led_init();
+
+bool status_led_set_state(bool led_on);
@@ -0,0 +1,33 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include "pico/types.h"
+
+// virtual clock - only moves when code waits (sleep, busy wait, tight loop) or the emulator advances it
+
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void *user_data);
+
+uint32_t time_us_32();
+
+uint64_t time_us_64();
+
+void sleep_ms(uint32_t ms);
+
+void sleep_us(uint64_t us);
+
+void busy_wait_us(uint64_t us);
+
+void busy_wait_until(absolute_time_t t);
+
+absolute_time_t get_absolute_time();
+
+absolute_time_t make_timeout_time_us(uint64_t us);
+
+int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to);
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past);
+
+bool cancel_alarm(alarm_id_t id);
@@ -0,0 +1,18 @@
+// Copyright (C) 2026 Laurynas 'Deviltry' Ekekeke
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+// host stand-ins for the Pico SDK, just enough for the LED modules (implemented in sdk.c)
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+#define __not_in_flash_func(x) x
+#define __time_critical_func(x) x
+#define __force_inline inline
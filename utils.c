@@ -58,12 +58,29 @@ void utils_printf_impl(const char *format, ...) {
 	atomic_flag_clear_explicit(&utils_printf_lock, memory_order_release);
 }
 
+u32 utils_random_bounded(const u32 range) {
+	// Lemire's multiply-shift with rejection - unbiased, unlike rnd % range
+	u32 x = get_rand_32();
+	if (unlikely(range == 0)) return x;
+
+	u64 m = (u64)x * range;
+	u32 low = (u32)m;
+	if (unlikely(low < range)) {
+		const u32 threshold = -range % range;
+		while (low < threshold) {
+			x = get_rand_32();
+			m = (u64)x * range;
+			low = (u32)m;
+		}
+	}
+	return (u32)(m >> 32);
+}
+
 u32 utils_random_in_range(u32 from_inclusive, u32 to_inclusive) {
 	if (from_inclusive > to_inclusive) utils_swap(&from_inclusive, &to_inclusive);
 
-	const auto range = to_inclusive - from_inclusive + 1; // +1 because to is inclusive
-	const auto rnd = get_rand_32();
-	return from_inclusive + (rnd % range);
+	const auto range = to_inclusive - from_inclusive + 1; // +1 because to is inclusive (wraps to 0 for full range)
+	return from_inclusive + utils_random_bounded(range);
 }
 
 void utils_random_bytes(u8 *buffer, const size_t len) {
@@ -84,6 +101,11 @@ float utils_calculate_pio_clk_div_ns(const float instruction_execution_in_ns) {
 	return utils_calculate_pio_clk_div(instruction_execution_in_ns / 1'000.0f);
 }
 
+u32 utils_calculate_pio_clk_div_ns_fx(const u32 instruction_execution_in_ns) {
+	const u64 frequency_hz = clock_get_hz(clk_sys);
+	return (u32)((frequency_hz * instruction_execution_in_ns * 256u + 500'000'000u) / 1'000'000'000u);
+}
+
 float utils_calculate_pwm_divider(const u32 top, const float freq_khz) {
 	const auto clock = clock_get_hz(clk_sys);
 
@@ -106,6 +128,28 @@ float utils_calculate_pwm_divider(const u32 top, const float freq_khz) {
 	return divider;
 }
 
+u16 utils_calculate_pwm_divider_fx(const u32 top, const u32 freq_hz) {
+	static constexpr u32 DIV_MIN = 1u << 4;
+	static constexpr u32 DIV_MAX = (256u << 4) - 1u;
+	const u64 clock = clock_get_hz(clk_sys);
+
+	if (freq_hz == 0) return DIV_MIN;
+
+	const u64 denominator = (u64)freq_hz * (top + 1u);
+	const u64 divider = (clock * 16u + denominator / 2u) / denominator;
+
+	if (divider < DIV_MIN) {
+		utils_printf("!!! DIVIDER LESS THAN 1 (%lu/16), CONSIDER ADJUSTING TOP\n", (unsigned long)divider);
+		return DIV_MIN;
+	}
+	if (divider > DIV_MAX) {
+		utils_printf("!!! DIVIDER MORE THAN 256 (~%lu), CONSIDER ADJUSTING TOP\n", (unsigned long)(divider >> 4));
+		return DIV_MAX;
+	}
+
+	return (u16)divider;
+}
+
 inline u32 utils_time_diff_ms(const u32 start_us, const u32 end_us) {
 	return (end_us - start_us) / 1000;
 }
@@ -182,6 +226,14 @@ i32 utils_proportional_reduce(const i32 number, i32 step, const i32 total_steps,
 	return result;
 }
 
+i32 utils_proportional_reduce_q16(const i32 number, q16_t fraction, const bool invert) {
+	fraction = fx_clamp(fraction, 0, Q16_ONE);
+
+	const auto result = fx_scale(number, fraction);
+	if (invert) return number - result;
+	return result;
+}
+
 i32 utils_scaled_pwm_percentage(const i32 val, const i32 deadzone, const i32 max_val) {
 	const i32 x = abs(val);
 	if (x <= deadzone) {
@@ -245,12 +297,8 @@ void utils_generate_id(char *dst, const size_t len) {
 	if (dst == nullptr || len == 0) return;
 
 	const size_t n = len - 1; // generate exactly n symbols; leave 1 for NUL
-	for (size_t i = 0; i < n; ++i) {
-		const auto idx = utils_random_in_range(0, SYMBOLS_LEN - 1);
-		dst[i] = SYMBOLS[idx];
-	}
+	for (size_t i = 0; i < n; ++i) dst[i] = SYMBOLS[utils_random_bounded(SYMBOLS_LEN)];
 	dst[n] = '\0';
-	utils_printf("len=%zu, id=%s\n", n, dst);
 }
 
 void utils_base64_encode(const u8 *input, const size_t len, char *output, const size_t out_cap) {
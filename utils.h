@@ -6,6 +6,7 @@
 #include <hardware/pwm.h>
 #include <stdio.h>
 
+#include "fixed.h"
 #include "shared_config.h"
 
 struct async_context;
@@ -210,6 +211,16 @@ i32*: utils_avg_i32,  \
 float*: utils_avg_float  \
 )(array, array_size)
 
+/**
+ * Unbiased random number in [0, range) from the hardware TRNG - slow, use \c rng_* (rng.h) for effects and jitter
+ *
+ * @param range 0 means full 32 bit range
+ */
+u32 utils_random_bounded(const u32 range);
+
+/**
+ * @attention Hardware TRNG - meant for ids and other security sensitive stuff, use \c rng_range (rng.h) for bulk randoms
+ */
 u32 utils_random_in_range(u32 from_inclusive, u32 to_inclusive);
 
 void utils_random_bytes(u8 *buffer, const size_t len);
@@ -218,6 +229,13 @@ float utils_calculate_pio_clk_div(const float instruction_execution_in_us);
 
 float utils_calculate_pio_clk_div_ns(const float instruction_execution_in_ns);
 
+/**
+ * Integer variant of \c utils_calculate_pio_clk_div_ns
+ *
+ * @return Divider in 16.8 fixed point (\c sm_config_set_clkdiv_int_frac8(&c, div >> 8, div & 0xFF))
+ */
+u32 utils_calculate_pio_clk_div_ns_fx(const u32 instruction_execution_in_ns);
+
 /**
  * Calculates PWM clock. 1 khz = every 1 ms, 2 khz = ever 0.5 ms, etc
  *
@@ -226,6 +244,15 @@ float utils_calculate_pio_clk_div_ns(const float instruction_execution_in_ns);
  */
 float utils_calculate_pwm_divider(const u32 top, const float freq_khz);
 
+/**
+ * Integer variant of \c utils_calculate_pwm_divider
+ *
+ * @param top PWM TOP configuration (wrap)
+ * @param freq_hz Desired frequency in Hz
+ * @return Divider in 8.4 fixed point (\c pwm_set_clkdiv_int_frac4(slice, div >> 4, div & 0xF)), clamped to 1.0..255.9375
+ */
+u16 utils_calculate_pwm_divider_fx(const u32 top, const u32 freq_hz);
+
 void utils_printf_impl(const char *format, ...);
 
 void utils_printf_sink(const char *text, const size_t len);
@@ -255,6 +282,13 @@ void utils_internal_led(const bool on);
 
 i32 utils_proportional_reduce(const i32 number, i32 step, const i32 total_steps, const bool invert);
 
+/**
+ * Fixed point variant of \c utils_proportional_reduce, no float or division
+ *
+ * @param fraction step / total_steps in Q16 (0..Q16_ONE, clamped) - compute once per frame, not per pixel
+ */
+i32 utils_proportional_reduce_q16(const i32 number, q16_t fraction, const bool invert);
+
 i32 utils_scaled_pwm_percentage(const i32 val, const i32 deadzone, const i32 max_val);
 
 u16 *utils_pwm_cc_for_16bit(const u8 slice, const u8 channel);